@@ -1058,13 +1058,9 @@ bool HasDuplicateAssets(const std::vector<OHOS::NativeRdb::ValuesBucket> &values
 
 bool HasDuplicateAssets(const OHOS::NativeRdb::ValuesBuckets &values)
 {
-    const auto &[fields, vals] = values.GetFieldsAndValues();
-    for (const auto &valueObject : *vals) {
-        if (HasDuplicateAssets(valueObject)) {
-            return true;
-        }
-    }
-    return false;
+    return values.AnyOf([](const OHOS::NativeRdb::ValueObject &value) {
+        return HasDuplicateAssets(value);
+    });
 }
 
 std::shared_ptr<OHOS::NativeRdb::RdbPredicates> GetNativePredicatesFromTaihe(
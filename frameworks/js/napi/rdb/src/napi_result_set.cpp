@@ -54,9 +54,14 @@ napi_value ResultSetProxy::NewInstance(napi_env env, std::shared_ptr<AbsSharedRe
         return instance;
     }
 
-    if (resultSet != nullptr && resultSet->GetBlock() != nullptr) {
-        proxy->sharedBlockName_ = resultSet->GetBlock()->Name();
-        proxy->sharedBlockAshmemFd_ = resultSet->GetBlock()->GetFd();
+    auto block = resultSet != nullptr ? resultSet->GetBlock() : nullptr;
+    if (block != nullptr) {
+        // the fd is handed out to others, so the local block moves to the shared memory first.
+        if (!block->IsShared() && block->Promote() != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+            LOG_ERROR("Promote the shared block failed.");
+        }
+        proxy->sharedBlockName_ = block->Name();
+        proxy->sharedBlockAshmemFd_ = block->GetFd();
     }
     proxy->sharedResultSet_ = resultSet;
     return instance;
@@ -21,6 +21,7 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <codecvt>
 #include <iostream>
 
@@ -35,8 +36,15 @@ std::atomic<int64_t> identifier{ 0 };
 
 #define LIKELY(x) __builtin_expect(!!(x), 1)
 #define UNLIKELY(x) __builtin_expect(!!(x), 0)
+static std::string GetAshmemName(const std::string &name)
+{
+    size_t lastSlashPos = name.find_last_of('/');
+    std::string ashmemPath = (lastSlashPos != std::string::npos) ? name.substr(lastSlashPos) : name;
+    return "SharedBlock:" + ashmemPath + std::to_string(identifier.fetch_add(1));
+}
+
 SharedBlock::SharedBlock(const std::string &name, sptr<Ashmem> ashmem, size_t size, bool readOnly)
-    : mName(name), ashmem_(ashmem), mSize(size), mReadOnly(readOnly), mHeader(nullptr)
+    : mName(name), ashmem_(ashmem), mData(nullptr), mSize(size), mReadOnly(readOnly), mHeader(nullptr)
 {
 }
 
@@ -45,12 +53,17 @@ SharedBlock::~SharedBlock()
     if (ashmem_ != nullptr) {
         ashmem_->UnmapAshmem();
         ashmem_->CloseAshmem();
+        return;
     }
+    // the local block owns its memory.
+    delete[] mData;
 }
 
 bool SharedBlock::Init()
 {
-    mData = static_cast<uint8_t *>(const_cast<void *>(ashmem_->ReadFromAshmem(sizeof(SharedBlockHeader), 0)));
+    if (ashmem_ != nullptr) {
+        mData = static_cast<uint8_t *>(const_cast<void *>(ashmem_->ReadFromAshmem(sizeof(SharedBlockHeader), 0)));
+    }
     mHeader = reinterpret_cast<SharedBlockHeader *>(mData);
     if (mHeader == nullptr) {
         return false;
@@ -78,11 +91,7 @@ int SharedBlock::CreateSharedBlock(
 
 int SharedBlock::Create(const std::string &name, size_t size, SharedBlock *&outSharedBlock)
 {
-    std::string ashmemPath;
-    size_t lastSlashPos = name.find_last_of('/');
-    ashmemPath = (lastSlashPos != std::string::npos) ? name.substr(lastSlashPos) : name;
-    std::string ashmemName = "SharedBlock:" + ashmemPath + std::to_string(identifier.fetch_add(1));
-
+    std::string ashmemName = GetAshmemName(name);
     sptr<Ashmem> ashmem = Ashmem::CreateAshmem(ashmemName.c_str(), size);
     if (ashmem == nullptr) {
         LOG_ERROR("Failed to create ashmem errno %{public}d", errno);
@@ -106,8 +115,65 @@ int SharedBlock::Create(const std::string &name, size_t size, SharedBlock *&outS
     return result;
 }
 
+int SharedBlock::CreateLocal(const std::string &name, size_t size, SharedBlock *&outSharedBlock)
+{
+    outSharedBlock = nullptr;
+    if (size < sizeof(SharedBlockHeader) + sizeof(RowGroupHeader)) {
+        LOG_ERROR("CreateLocal: size %{public}zu is too small.", size);
+        return SHARED_BLOCK_BAD_VALUE;
+    }
+    auto block = new (std::nothrow) SharedBlock(name, nullptr, size, false);
+    if (block == nullptr) {
+        LOG_ERROR("CreateLocal: new SharedBlock error.");
+        return SHARED_BLOCK_NO_MEMORY;
+    }
+    block->mData = new (std::nothrow) uint8_t[size];
+    if (block->mData == nullptr) {
+        delete block;
+        LOG_ERROR("CreateLocal: no memory for %{public}zu bytes.", size);
+        return SHARED_BLOCK_NO_MEMORY;
+    }
+    block->Init();
+    outSharedBlock = block;
+    return SHARED_BLOCK_OK;
+}
+
+/**
+ * Moves the local block to the shared memory, the unused part of the new shared memory is zeroed.
+ */
+int SharedBlock::Promote()
+{
+    std::string ashmemName = GetAshmemName(mName);
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem(ashmemName.c_str(), mSize);
+    if (ashmem == nullptr) {
+        LOG_ERROR("Failed to create ashmem errno %{public}d", errno);
+        return SHARED_BLOCK_ASHMEM_ERROR;
+    }
+    if (!ashmem->MapReadAndWriteAshmem()) {
+        LOG_ERROR("Promote: MapReadAndWriteAshmem function error.");
+        ashmem->CloseAshmem();
+        return SHARED_BLOCK_SET_PORT_ERROR;
+    }
+    auto data = static_cast<uint8_t *>(const_cast<void *>(ashmem->ReadFromAshmem(sizeof(SharedBlockHeader), 0)));
+    size_t used = std::min(static_cast<size_t>(mHeader->unusedOffset), mSize);
+    if (data == nullptr || memcpy_s(data, mSize, mData, used) != EOK) {
+        LOG_ERROR("Promote: copy %{public}zu bytes failed.", used);
+        ashmem->UnmapAshmem();
+        ashmem->CloseAshmem();
+        return SHARED_BLOCK_ASHMEM_ERROR;
+    }
+    delete[] mData;
+    ashmem_ = ashmem;
+    mData = data;
+    mHeader = reinterpret_cast<SharedBlockHeader *>(mData);
+    return SHARED_BLOCK_OK;
+}
+
 int SharedBlock::WriteMessageParcel(MessageParcel &parcel)
 {
+    if (ashmem_ == nullptr && Promote() != SHARED_BLOCK_OK) {
+        return false;
+    }
     return parcel.WriteString16(OHOS::Str8ToStr16(mName)) && parcel.WriteAshmem(ashmem_);
 }
 
@@ -167,6 +233,25 @@ int SharedBlock::Clear()
     return SHARED_BLOCK_BAD_VALUE;
 }
 
+int SharedBlock::Recycle()
+{
+    // the block in the shared memory may have been mapped by others.
+    if (UNLIKELY(ashmem_ != nullptr)) {
+        return SHARED_BLOCK_INVALID_OPERATION;
+    }
+    return Clear();
+}
+
+int SharedBlock::Rename(const std::string &name)
+{
+    // the name of the shared memory is given when it is created.
+    if (UNLIKELY(ashmem_ != nullptr)) {
+        return SHARED_BLOCK_INVALID_OPERATION;
+    }
+    mName = name;
+    return SHARED_BLOCK_OK;
+}
+
 int SharedBlock::SetColumnNum(uint32_t numColumns)
 {
     if (UNLIKELY(mReadOnly)) {
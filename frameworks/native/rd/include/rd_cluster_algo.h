@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_RD_CLUSTER_ALGO_H
+#define NATIVE_RDB_RD_CLUSTER_ALGO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "grd_type_export.h"
+
+namespace OHOS {
+namespace NativeRdb {
+/**
+ * @brief The bundled cluster algorithm of the IVFCLUSTER index, a mini-batch k-means seeded by k-means++.
+ * The historical centers keep their cluster ids and stay fixed, the new vectors join the nearest of them or of
+ * the new centers, which take the ids from newClusterIdStart. The seed is fixed, so the same input always gives
+ * the same clusters.
+ */
+class RdClusterAlgo {
+public:
+    static int32_t KMeans(GRD_ClstAlgoParaT *para);
+
+private:
+    using Engine = std::mt19937;
+    struct Centers {
+        size_t dim = 0;
+        size_t oldNum = 0;
+        std::vector<float> features;
+        size_t Size() const
+        {
+            return features.size() / dim;
+        }
+        const float *At(size_t index) const
+        {
+            return features.data() + index * dim;
+        }
+    };
+    static constexpr uint32_t SEED = 5489;
+    static constexpr size_t SEED_SAMPLES_PER_CLUSTER = 64;
+    static constexpr size_t BATCH_SIZE = 1024;
+    static constexpr size_t MIN_ITERATIONS = 10;
+    static constexpr size_t MAX_ITERATIONS = 100;
+
+    static bool IsValid(const GRD_ClstAlgoParaT *para);
+    static size_t GetNewClusterNum(const GRD_ClstAlgoParaT *para);
+    static void SeedCenters(const GRD_ClstAlgoParaT *para, size_t newNum, Engine &engine, Centers &centers);
+    static void TrainCenters(const GRD_ClstAlgoParaT *para, Engine &engine, Centers &centers);
+    static void AssignClusters(const GRD_ClstAlgoParaT *para, const Centers &centers);
+    static size_t Nearest(const float *feature, const Centers &centers, float &distance);
+    static size_t Uniform(Engine &engine, size_t bound);
+};
+} // namespace NativeRdb
+} // namespace OHOS
+#endif // NATIVE_RDB_RD_CLUSTER_ALGO_H
@@ -23,6 +23,7 @@
 #include "rd_connection.h"
 #include "rd_utils.h"
 #include "rdb_store_config.h"
+#include "share_block.h"
 #include "statement.h"
 #include "value_object.h"
 
@@ -52,6 +53,7 @@ public:
     std::pair<int32_t, int32_t> GetColumnType(int32_t index) const override;
     std::pair<int32_t, size_t> GetSize(int32_t index) const override;
     std::pair<int32_t, ValueObject> GetColumn(int32_t index) const override;
+    std::pair<int32_t, Float32View> GetFloat32View(int32_t index) const override;
     bool ReadOnly() const override;
     bool SupportBlockInfo() const override;
     int32_t FillBlockInfo(SharedBlockInfo *info, int retryTime = RETRY_TIME) const override;
@@ -61,20 +63,29 @@ public:
 private:
     friend class RdConnection;
     int Prepare(GRD_DB *db, const std::string &sql);
-    int32_t Bind(const std::vector<std::reference_wrapper<ValueObject>> &args);
-    int InnerBindBlobTypeArgs(const ValueObject &bindArg, uint32_t index) const;
+    int32_t Bind(const std::vector<std::reference_wrapper<ValueObject>> &args, bool isInPlace = false);
+    int InnerBindBlobTypeArgs(const ValueObject &bindArg, uint32_t index, bool isInPlace);
+    void ReleaseInPlace();
+    int32_t InnerStep() const;
+    int32_t InnerReset() const;
+    void FillRow(SharedBlockInfo &info) const;
+    FillOneRowResult FillOneRow(AppDataFwk::AbsSharedBlock *block, int32_t row, int32_t numColumns) const;
     int IsValid(int index) const;
     int PreGetColCount();
 
     bool readOnly_ = false;
     bool bound_ = false;
-    bool isStepInPrepare_ = false;
-    int stepCnt_ = 0;
+    mutable bool isStepInPrepare_ = false;
+    mutable int stepCnt_ = 0;
+    // the rows stepped since the last reset, the current row is the last of them.
+    mutable int32_t stepRows_ = 0;
     std::string sql_ = "";
     GRD_SqlStmt *stmtHandle_ = nullptr;
     GRD_DB *dbHandle_ = nullptr;
     std::shared_ptr<Connection> conn_;
     int columnCount_ = 0;
+    // the parameters bound to the caller-owned vectors, they are unbound before Execute returns.
+    std::vector<uint32_t> inPlaceIndexes_;
 
     std::map<std::string, std::function<int32_t(const int &value)>> setPragmas_;
     std::map<std::string, std::function<int32_t(int &version)>> getPragmas_;
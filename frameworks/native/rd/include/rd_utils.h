@@ -62,7 +62,14 @@ public:
     static int RdSqlBindDouble(GRD_SqlStmt *stmt, uint32_t idx, double val);
     static int RdSqlBindNull(GRD_SqlStmt *stmt, uint32_t idx);
     static int RdSqlBindFloatVector(
-        GRD_SqlStmt *stmt, uint32_t idx, float *val, uint32_t dim, void (*freeFunc)(void *));
+        GRD_SqlStmt *stmt, uint32_t idx, const float *val, uint32_t dim, void (*freeFunc)(void *));
+    /**
+    * @brief Binds a float vector to a parameter without copying it.
+    *
+    * @param val       The caller-owned vector, it must stay valid until the parameter is bound again or the
+    *                  statement is reset or finalized.
+    */
+    static int RdSqlBindFloatVectorInPlace(GRD_SqlStmt *stmt, uint32_t idx, const float *val, uint32_t dim);
 
     static int RdSqlStep(GRD_SqlStmt *stmt);
     static int RdSqlColCnt(GRD_SqlStmt *stmt);
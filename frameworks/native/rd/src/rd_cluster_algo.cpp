@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define LOG_TAG "RdClusterAlgo"
+#include "rd_cluster_algo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "grd_error.h"
+#include "logger.h"
+#include "vector_distance.h"
+
+namespace OHOS {
+namespace NativeRdb {
+using namespace OHOS::Rdb;
+
+int32_t RdClusterAlgo::KMeans(GRD_ClstAlgoParaT *para)
+{
+    if (!IsValid(para)) {
+        return GRD_INVALID_ARGS;
+    }
+    if (para->newFeaturesNum == 0) {
+        return GRD_OK;
+    }
+    Centers centers;
+    centers.dim = para->featureDim;
+    centers.oldNum = para->oldFeaturesNum;
+    centers.features.assign(para->oldFeatures, para->oldFeatures + centers.oldNum * centers.dim);
+    Engine engine(SEED);
+    SeedCenters(para, GetNewClusterNum(para), engine, centers);
+    TrainCenters(para, engine, centers);
+    AssignClusters(para, centers);
+    return GRD_OK;
+}
+
+bool RdClusterAlgo::IsValid(const GRD_ClstAlgoParaT *para)
+{
+    if (para == nullptr || para->featureDim == 0) {
+        LOG_ERROR("Invalid para, null: %{public}d.", para == nullptr);
+        return false;
+    }
+    if (para->newFeaturesNum > 0 && (para->newFeatures == nullptr || para->clusterResult == nullptr)) {
+        LOG_ERROR("Invalid new features, num: %{public}u.", para->newFeaturesNum);
+        return false;
+    }
+    if (para->oldFeaturesNum > 0 && (para->oldFeatures == nullptr || para->oldClstGroupId == nullptr)) {
+        LOG_ERROR("Invalid old features, num: %{public}u.", para->oldFeaturesNum);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Gets the number of the new clusters, which makes about sqrt(n) clusters for all n vectors as the IVF indexes
+ * usually do. One new cluster is seeded even if the old ones are enough, since the new vectors may be far from
+ * all of them.
+ */
+size_t RdClusterAlgo::GetNewClusterNum(const GRD_ClstAlgoParaT *para)
+{
+    size_t total = para->newFeaturesNum;
+    for (uint32_t i = 0; i < para->oldFeaturesNum; ++i) {
+        total += (para->oldClstVecNum == nullptr) ? 1 : static_cast<size_t>(std::max(para->oldClstVecNum[i], 1));
+    }
+    auto target = std::max<size_t>(static_cast<size_t>(std::lround(std::sqrt(static_cast<double>(total)))), 1);
+    size_t newNum = (target > para->oldFeaturesNum) ? target - para->oldFeaturesNum : 1;
+    return std::min<size_t>(newNum, para->newFeaturesNum);
+}
+
+/**
+ * Seeds the new centers by k-means++ on the evenly strided samples of the new vectors, the distance of a sample
+ * counts the old centers too. The seeding stops early when all samples are on the centers.
+ */
+void RdClusterAlgo::SeedCenters(const GRD_ClstAlgoParaT *para, size_t newNum, Engine &engine, Centers &centers)
+{
+    size_t featureNum = para->newFeaturesNum;
+    size_t sampleNum = std::min(featureNum, newNum * SEED_SAMPLES_PER_CLUSTER);
+    auto sample = [para, featureNum, sampleNum, &centers](size_t index) {
+        return para->newFeatures + (index * featureNum / sampleNum) * centers.dim;
+    };
+    std::vector<float> minDistances(sampleNum, std::numeric_limits<float>::max());
+    if (centers.Size() > 0) {
+        for (size_t i = 0; i < sampleNum; ++i) {
+            Nearest(sample(i), centers, minDistances[i]);
+        }
+    }
+    for (size_t center = 0; center < newNum; ++center) {
+        size_t picked = 0;
+        if (centers.Size() == 0) {
+            picked = Uniform(engine, sampleNum);
+        } else {
+            double sum = 0;
+            for (auto distance : minDistances) {
+                sum += distance;
+            }
+            if (sum <= 0) {
+                break;
+            }
+            double target = sum * (static_cast<double>(engine()) / (static_cast<double>(Engine::max()) + 1.0));
+            for (picked = 0; picked + 1 < sampleNum && target >= minDistances[picked]; ++picked) {
+                target -= minDistances[picked];
+            }
+        }
+        const float *feature = sample(picked);
+        centers.features.insert(centers.features.end(), feature, feature + centers.dim);
+        for (size_t i = 0; i < sampleNum; ++i) {
+            float distance = VectorDistance::L2Square(sample(i), feature, centers.dim);
+            minDistances[i] = std::min(minDistances[i], distance);
+        }
+    }
+}
+
+/**
+ * Moves the new centers by the mini-batch k-means, each center steps to the vectors of the batch assigned to it
+ * at the rate of 1 / the vectors it has taken. The old centers are only the competitors.
+ */
+void RdClusterAlgo::TrainCenters(const GRD_ClstAlgoParaT *para, Engine &engine, Centers &centers)
+{
+    size_t featureNum = para->newFeaturesNum;
+    if (centers.Size() <= centers.oldNum) {
+        return;
+    }
+    size_t batchSize = std::min(featureNum, BATCH_SIZE);
+    size_t iterations = std::clamp((featureNum + batchSize - 1) / batchSize, MIN_ITERATIONS, MAX_ITERATIONS);
+    std::vector<uint32_t> counts(centers.Size() - centers.oldNum, 0);
+    std::vector<size_t> batch(batchSize);
+    std::vector<size_t> nearest(batchSize);
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+        for (size_t i = 0; i < batchSize; ++i) {
+            batch[i] = Uniform(engine, featureNum);
+            float distance = 0;
+            nearest[i] = Nearest(para->newFeatures + batch[i] * centers.dim, centers, distance);
+        }
+        for (size_t i = 0; i < batchSize; ++i) {
+            if (nearest[i] < centers.oldNum) {
+                continue;
+            }
+            float rate = 1.0f / static_cast<float>(++counts[nearest[i] - centers.oldNum]);
+            float *center = centers.features.data() + nearest[i] * centers.dim;
+            const float *feature = para->newFeatures + batch[i] * centers.dim;
+            for (size_t j = 0; j < centers.dim; ++j) {
+                center[j] += rate * (feature[j] - center[j]);
+            }
+        }
+    }
+}
+
+void RdClusterAlgo::AssignClusters(const GRD_ClstAlgoParaT *para, const Centers &centers)
+{
+    // the ids of the new clusters are given in the order of use, so no id is left without vectors.
+    std::vector<int32_t> newIds(centers.Size() - centers.oldNum, -1);
+    int32_t nextId = para->newClusterIdStart;
+    for (uint32_t i = 0; i < para->newFeaturesNum; ++i) {
+        float distance = 0;
+        size_t index = Nearest(para->newFeatures + static_cast<size_t>(i) * centers.dim, centers, distance);
+        if (index < centers.oldNum) {
+            para->clusterResult[i] = para->oldClstGroupId[index];
+            continue;
+        }
+        int32_t &id = newIds[index - centers.oldNum];
+        if (id < 0) {
+            id = nextId++;
+        }
+        para->clusterResult[i] = id;
+    }
+}
+
+size_t RdClusterAlgo::Nearest(const float *feature, const Centers &centers, float &distance)
+{
+    size_t nearest = 0;
+    distance = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < centers.Size(); ++i) {
+        float current = VectorDistance::L2Square(feature, centers.At(i), centers.dim);
+        if (current < distance) {
+            distance = current;
+            nearest = i;
+        }
+    }
+    return nearest;
+}
+
+size_t RdClusterAlgo::Uniform(Engine &engine, size_t bound)
+{
+    // the modulo keeps the sequence the same on all platforms, which the distributions do not promise.
+    return static_cast<size_t>(engine()) % bound;
+}
+} // namespace NativeRdb
+} // namespace OHOS
@@ -21,6 +21,7 @@
 
 #include "grd_api_manager.h"
 #include "logger.h"
+#include "rd_cluster_algo.h"
 #include "rd_statement.h"
 #include "rdb_errno.h"
 #include "rdb_security_manager.h"
@@ -177,6 +178,13 @@ int RdConnection::InnerOpen(const RdbStoreConfig &config)
         LOG_ERROR("Can not registry ThreadPool rd db %{public}d.", errCode);
         return errCode;
     }
+    // the clusters are built on the writer, the store still works without the bundled algo.
+    if (isWriter_) {
+        auto ret = RdUtils::RdSqlRegistryClusterAlgo(dbHandle_, KMEANS_CLUSTER_ALGO, &RdClusterAlgo::KMeans);
+        if (ret != E_OK) {
+            LOG_WARN("Can not registry %{public}s in rd db %{public}d.", KMEANS_CLUSTER_ALGO, ret);
+        }
+    }
     return errCode;
 }
 
@@ -15,11 +15,15 @@
 #define LOG_TAG "RdStatement"
 #include "rd_statement.h"
 
+#include <unistd.h>
+
 #include <chrono>
 #include <cinttypes>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
+#include "abs_shared_block.h"
 #include "corrupted_handle_manager.h"
 #include "logger.h"
 #include "raw_data_parser.h"
@@ -27,6 +31,7 @@
 #include "rd_utils.h"
 #include "rdb_errno.h"
 #include "rdb_fault_hiview_reporter.h"
+#include "shared_block.h"
 #include "sqlite_global_config.h"
 #include "sqlite_utils.h"
 
@@ -44,6 +49,7 @@ RdStatement::~RdStatement()
 }
 
 constexpr size_t PRAGMA_VERSION_SQL_LEN = __builtin_strlen(GlobalExpr::PRAGMA_VERSION);
+constexpr unsigned int BUSY_SLEEP_TIME = 1000;
 
 static bool TryEatSymbol(const std::string &str, char symbol, size_t &curIdx)
 {
@@ -165,7 +171,7 @@ int RdStatement::Finalize()
     return E_OK;
 }
 
-int RdStatement::InnerBindBlobTypeArgs(const ValueObject &arg, uint32_t index) const
+int RdStatement::InnerBindBlobTypeArgs(const ValueObject &arg, uint32_t index, bool isInPlace)
 {
     int ret = E_OK;
     switch (arg.GetType()) {
@@ -199,10 +205,18 @@ int RdStatement::InnerBindBlobTypeArgs(const ValueObject &arg, uint32_t index) c
             break;
         }
         case ValueObjectType::TYPE_VECS: {
-            ValueObject::FloatVector vectors;
-            arg.GetVecs(vectors);
-            ret = RdUtils::RdSqlBindFloatVector(
-                stmtHandle_, index, static_cast<float *>(vectors.data()), vectors.size(), nullptr);
+            auto vectors = std::get_if<ValueObject::FloatVector>(&arg.value);
+            if (vectors == nullptr) {
+                return E_INVALID_OBJECT_TYPE;
+            }
+            if (!isInPlace) {
+                ret = RdUtils::RdSqlBindFloatVector(stmtHandle_, index, vectors->data(), vectors->size(), nullptr);
+                break;
+            }
+            ret = RdUtils::RdSqlBindFloatVectorInPlace(stmtHandle_, index, vectors->data(), vectors->size());
+            if (ret == E_OK) {
+                inPlaceIndexes_.push_back(index);
+            }
             break;
         }
         default: {
@@ -262,7 +276,7 @@ int32_t RdStatement::Bind(const std::vector<ValueObject> &args)
     return Bind(refArgs);
 }
 
-int32_t RdStatement::Bind(const std::vector<std::reference_wrapper<ValueObject>> &args)
+int32_t RdStatement::Bind(const std::vector<std::reference_wrapper<ValueObject>> &args, bool isInPlace)
 {
     uint32_t index = 1;
     int ret = E_OK;
@@ -289,12 +303,13 @@ int32_t RdStatement::Bind(const std::vector<std::reference_wrapper<ValueObject>>
                 break;
             }
             default: {
-                ret = InnerBindBlobTypeArgs(arg, index);
+                ret = InnerBindBlobTypeArgs(arg, index, isInPlace);
                 break;
             }
         }
         if (ret != E_OK) {
             LOG_ERROR("Bind ret is %{public}d", ret);
+            ReleaseInPlace();
             return ret;
         }
         index++;
@@ -302,12 +317,38 @@ int32_t RdStatement::Bind(const std::vector<std::reference_wrapper<ValueObject>>
     return PreGetColCount();
 }
 
+void RdStatement::ReleaseInPlace()
+{
+    if (inPlaceIndexes_.empty()) {
+        return;
+    }
+    // the caller-owned vectors may be freed after Execute returns, GRD must not keep them.
+    RdUtils::RdSqlReset(stmtHandle_);
+    for (auto index : inPlaceIndexes_) {
+        RdUtils::RdSqlBindNull(stmtHandle_, index);
+    }
+    inPlaceIndexes_.clear();
+}
+
 std::pair<int32_t, int32_t> RdStatement::Count()
 {
-    return { E_NOT_SUPPORT, INVALID_COUNT };
+    SharedBlockInfo info(nullptr);
+    info.isCountAllRows = true;
+    info.isFull = true;
+    info.totalRows = -1;
+    auto errCode = FillBlockInfo(&info);
+    if (errCode != E_OK) {
+        return { errCode, INVALID_COUNT };
+    }
+    return { errCode, info.totalRows };
 }
 
 int32_t RdStatement::Step()
+{
+    return InnerStep();
+}
+
+int32_t RdStatement::InnerStep() const
 {
     if (stmtHandle_ == nullptr) {
         return E_OK;
@@ -322,15 +363,24 @@ int32_t RdStatement::Step()
         CorruptedHandleManager::GetInstance().HandleCorrupt(*config_);
     }
     stepCnt_++;
+    if (ret == E_OK) {
+        stepRows_++;
+    }
     return ret;
 }
 
 int32_t RdStatement::Reset()
+{
+    return InnerReset();
+}
+
+int32_t RdStatement::InnerReset() const
 {
     if (stmtHandle_ == nullptr) {
         return E_OK;
     }
     stepCnt_ = 0;
+    stepRows_ = 0;
     isStepInPrepare_ = false;
     return RdUtils::RdSqlReset(stmtHandle_);
 }
@@ -352,7 +402,8 @@ int32_t RdStatement::Execute(const std::vector<std::reference_wrapper<ValueObjec
         // rd kernal will support pragma in later version
         return E_OK;
     }
-    int ret = Bind(args);
+    // the args outlive the step of a write statement, so its vectors are bound without copying.
+    int ret = Bind(args, !readOnly_);
     if (ret != E_OK) {
         LOG_ERROR("RdConnection unable to prepare and bind stmt : err %{public}d", ret);
         return ret;
@@ -361,6 +412,7 @@ int32_t RdStatement::Execute(const std::vector<std::reference_wrapper<ValueObjec
     if (ret != E_OK && ret != E_NO_MORE_ROWS) {
         LOG_ERROR("RdConnection Execute : err %{public}d", ret);
     }
+    ReleaseInPlace();
     return ret;
 }
 
@@ -479,8 +531,7 @@ std::pair<int32_t, ValueObject> RdStatement::GetColumn(int32_t index) const
             uint32_t dim = 0;
             auto vectors = reinterpret_cast<const float *>(RdUtils::RdSqlColumnFloatVector(stmtHandle_, index, &dim));
             std::vector<float> vecData;
-            if (dim > 0 || vectors != nullptr) {
-                vecData.resize(dim);
+            if (dim > 0 && vectors != nullptr) {
                 vecData.assign(vectors, vectors + dim);
             }
             object = std::move(vecData);
@@ -490,8 +541,7 @@ std::pair<int32_t, ValueObject> RdStatement::GetColumn(int32_t index) const
             int size = RdUtils::RdSqlColBytes(stmtHandle_, index);
             auto blob = static_cast<const uint8_t *>(RdUtils::RdSqlColBlob(stmtHandle_, index));
             std::vector<uint8_t> rawData;
-            if (size > 0 || blob != nullptr) {
-                rawData.resize(size);
+            if (size > 0 && blob != nullptr) {
                 rawData.assign(blob, blob + size);
             }
             object = std::move(rawData);
@@ -503,6 +553,26 @@ std::pair<int32_t, ValueObject> RdStatement::GetColumn(int32_t index) const
     return { ret, std::move(object) };
 }
 
+std::pair<int32_t, Float32View> RdStatement::GetFloat32View(int32_t index) const
+{
+    int ret = IsValid(index);
+    if (ret != E_OK) {
+        return { ret, {} };
+    }
+    ColumnType type = RdUtils::RdSqlColType(stmtHandle_, index);
+    if (type == ColumnType::TYPE_NULL) {
+        return { E_NULL_OBJECT, {} };
+    }
+    if (type != ColumnType::TYPE_FLOAT32_ARRAY) {
+        return { E_INVALID_OBJECT_TYPE, {} };
+    }
+    uint32_t dim = 0;
+    Float32View view;
+    view.data = RdUtils::RdSqlColumnFloatVector(stmtHandle_, index, &dim);
+    view.size = view.data == nullptr ? 0 : dim;
+    return { E_OK, view };
+}
+
 bool RdStatement::ReadOnly() const
 {
     return readOnly_;
@@ -510,12 +580,143 @@ bool RdStatement::ReadOnly() const
 
 bool RdStatement::SupportBlockInfo() const
 {
-    return false;
+    return true;
 }
 
+/**
+ * Steps the statement, counts the rows and puts the ones from info->startPos to the block until it is full. The
+ * statement stays on the row that did not fit, so the next fill of the following block resumes from it, and only
+ * a fill before that row steps again from the first row. The statement is reset when it is over or fails.
+ */
 int32_t RdStatement::FillBlockInfo(SharedBlockInfo *info, int retryTime) const
 {
-    return E_NOT_SUPPORT;
+    if (info == nullptr) {
+        return E_INVALID_ARGS;
+    }
+    if (stmtHandle_ == nullptr) {
+        return E_ALREADY_CLOSED;
+    }
+    // the row stepped in the prepare is not taken yet, so the statement is still before the first row.
+    int32_t stepRows = (isStepInPrepare_ && stepCnt_ == 1) ? 0 : stepRows_;
+    if (info->startPos < stepRows - 1) {
+        InnerReset();
+        stepRows = 0;
+    }
+    info->totalRows = stepRows;
+    info->addedRows = 0;
+    if (info->sharedBlock != nullptr && info->startPos < info->totalRows) {
+        FillRow(*info);
+    }
+    int retryCount = 0;
+    int32_t errCode = E_OK;
+    while (!info->hasException && (!info->isFull || info->isCountAllRows)) {
+        errCode = InnerStep();
+        if (errCode == E_DATABASE_BUSY && retryCount < retryTime) {
+            usleep(BUSY_SLEEP_TIME);
+            retryCount++;
+            continue;
+        }
+        if (errCode != E_OK) {
+            break;
+        }
+        retryCount = 0;
+        info->totalRows += 1;
+        if (info->sharedBlock != nullptr && info->startPos < info->totalRows && !info->isFull) {
+            FillRow(*info);
+        }
+    }
+    if (errCode != E_OK || info->hasException) {
+        InnerReset();
+    }
+    errCode = (errCode == E_NO_MORE_ROWS) ? E_OK : errCode;
+    if (errCode != E_OK || info->hasException) {
+        LOG_ERROR("Fill failed, errCode %{public}d, rows %{public}d.", errCode, info->totalRows);
+        return errCode != E_OK ? errCode : E_ERROR;
+    }
+    if (info->isFull && info->totalRows > 0 && info->addedRows == 0 && info->sharedBlock != nullptr) {
+        LOG_WARN("The row is over the block size, rows %{public}d.", info->totalRows);
+        InnerReset();
+        return E_ERROR;
+    }
+    return E_OK;
+}
+
+void RdStatement::FillRow(SharedBlockInfo &info) const
+{
+    auto result = FillOneRow(info.sharedBlock, info.addedRows, info.columnNum);
+    // the rows before the required one are dropped to make room for it.
+    if (result == SHARED_BLOCK_IS_FULL && info.addedRows > 0 && info.startPos + info.addedRows <= info.requiredPos) {
+        info.sharedBlock->Clear();
+        info.sharedBlock->SetColumnNum(info.columnNum);
+        info.startPos += info.addedRows;
+        info.addedRows = 0;
+        result = FillOneRow(info.sharedBlock, info.addedRows, info.columnNum);
+    }
+    if (result == FILL_ONE_ROW_SUCESS) {
+        info.addedRows += 1;
+    } else if (result == SHARED_BLOCK_IS_FULL) {
+        info.isFull = true;
+    } else {
+        info.hasException = true;
+    }
+}
+
+FillOneRowResult RdStatement::FillOneRow(AppDataFwk::AbsSharedBlock *block, int32_t row, int32_t numColumns) const
+{
+    if (block->AllocRow() != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+        return SHARED_BLOCK_IS_FULL;
+    }
+    FillOneRowResult result = FILL_ONE_ROW_SUCESS;
+    for (int32_t col = 0; col < numColumns && result == FILL_ONE_ROW_SUCESS; ++col) {
+        int status = AppDataFwk::SharedBlock::SHARED_BLOCK_OK;
+        ColumnType type = RdUtils::RdSqlColType(stmtHandle_, col);
+        switch (type) {
+            case ColumnType::TYPE_INTEGER:
+                status = block->PutLong(row, col, RdUtils::RdSqlColInt64(stmtHandle_, col));
+                break;
+            case ColumnType::TYPE_FLOAT:
+                status = block->PutDouble(row, col, RdUtils::RdSqlColDouble(stmtHandle_, col));
+                break;
+            case ColumnType::TYPE_STRING: {
+                auto text = RdUtils::RdSqlColText(stmtHandle_, col);
+                status = (text == nullptr) ? block->PutNull(row, col)
+                                           : block->PutString(row, col, text, strlen(text) + 1);
+                break;
+            }
+            case ColumnType::TYPE_BLOB: {
+                auto blob = RdUtils::RdSqlColBlob(stmtHandle_, col);
+                int size = RdUtils::RdSqlColBytes(stmtHandle_, col);
+                status = block->PutBlob(row, col, blob, (blob == nullptr || size < 0) ? 0 : size);
+                break;
+            }
+            case ColumnType::TYPE_FLOAT32_ARRAY: {
+                // the block keeps the vectors in the format of RawDataParser as the sqlite store does.
+                uint32_t dim = 0;
+                auto vectors = RdUtils::RdSqlColumnFloatVector(stmtHandle_, col, &dim);
+                ValueObject::FloatVector floats;
+                if (vectors != nullptr) {
+                    floats.assign(vectors, vectors + dim);
+                }
+                auto rawData = RawDataParser::PackageRawData(floats);
+                status = block->PutFloats(row, col, rawData.data(), rawData.size());
+                break;
+            }
+            case ColumnType::TYPE_NULL:
+                status = block->PutNull(row, col);
+                break;
+            default:
+                LOG_ERROR("Invalid type %{public}d, col %{public}d.", type, col);
+                result = FILL_ONE_ROW_FAIL;
+                continue;
+        }
+        if (status != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+            result = SHARED_BLOCK_IS_FULL;
+        }
+    }
+    if (result != FILL_ONE_ROW_SUCESS) {
+        block->FreeLastRow();
+    }
+    return result;
 }
 
 void RdStatement::GetProperties()
@@ -523,9 +724,43 @@ void RdStatement::GetProperties()
     columnCount_ = RdUtils::RdSqlColCnt(stmtHandle_);
 }
 
+/**
+ * Gets at most maxCount rows from the first row, the statement is reset at the end, so the next call starts from
+ * the first row again.
+ */
 std::pair<int32_t, std::vector<ValuesBucket>> RdStatement::GetRows(int32_t maxCount)
 {
-    return { E_NOT_SUPPORT, {} };
+    if (stmtHandle_ == nullptr) {
+        return { E_ALREADY_CLOSED, {} };
+    }
+    std::vector<std::string> colNames;
+    colNames.reserve(columnCount_);
+    for (int32_t i = 0; i < columnCount_; i++) {
+        auto [errCode, colName] = GetColumnName(i);
+        if (errCode != E_OK) {
+            return { errCode, {} };
+        }
+        colNames.push_back(std::move(colName));
+    }
+    std::vector<ValuesBucket> rows;
+    int32_t errCode = E_OK;
+    while (static_cast<int32_t>(rows.size()) < maxCount && (errCode = InnerStep()) == E_OK) {
+        ValuesBucket row;
+        for (int32_t i = 0; i < columnCount_; i++) {
+            auto [ret, value] = GetColumn(i);
+            if (ret != E_OK) {
+                InnerReset();
+                return { ret, {} };
+            }
+            row.Put(colNames[i], std::move(value));
+        }
+        rows.push_back(std::move(row));
+    }
+    InnerReset();
+    if (errCode != E_OK && errCode != E_NO_MORE_ROWS) {
+        return { errCode, {} };
+    }
+    return { E_OK, std::move(rows) };
 }
 std::pair<int, std::vector<ValuesBucket>> RdStatement::ExecuteForRows(
     const std::vector<ValueObject> &args, int32_t maxCount)
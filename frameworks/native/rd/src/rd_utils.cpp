@@ -378,7 +378,7 @@ void RdSqlFreeFloatArr(void *floatElement)
     delete[] ((float *)floatElement);
 }
 
-int RdUtils::RdSqlBindFloatVector(GRD_SqlStmt *stmt, uint32_t idx, float *val,
+int RdUtils::RdSqlBindFloatVector(GRD_SqlStmt *stmt, uint32_t idx, const float *val,
     uint32_t dim, void (*freeFunc)(void *))
 {
     if (GRD_KVApiInfo.DBSqlBindFloatVector == nullptr) {
@@ -412,6 +412,30 @@ int RdUtils::RdSqlBindFloatVector(GRD_SqlStmt *stmt, uint32_t idx, float *val,
     return result;
 }
 
+void RdSqlKeepFloatArr(void *floatElement)
+{
+}
+
+int RdUtils::RdSqlBindFloatVectorInPlace(GRD_SqlStmt *stmt, uint32_t idx, const float *val, uint32_t dim)
+{
+    if (GRD_KVApiInfo.DBSqlBindFloatVector == nullptr) {
+        GRD_KVApiInfo = GetApiInfoInstance();
+    }
+    if (GRD_KVApiInfo.DBSqlBindFloatVector == nullptr) {
+        return E_NOT_SUPPORT;
+    }
+    if (dim <= 0 || val == nullptr) {
+        LOG_ERROR("Invalid dim %{public}d", dim);
+        return E_INVALID_ARGS;
+    }
+    // the vector is owned by the caller, nothing to free when GRD releases it.
+    int result = TransferGrdErrno(GRD_KVApiInfo.DBSqlBindFloatVector(stmt, idx, val, dim, RdSqlKeepFloatArr));
+    if (result != E_OK) {
+        LOG_ERROR("DBSqlBindFloatVector failed, error code: %{public}d", result);
+    }
+    return result;
+}
+
 int RdUtils::RdSqlStep(GRD_SqlStmt *stmt)
 {
     if (GRD_KVApiInfo.DBSqlStep == nullptr) {
@@ -24,6 +24,7 @@
 
 #include "knowledge_types.h"
 #include "rdb_common.h"
+#include "rdb_errno.h"
 #include "rdb_store_config.h"
 #include "rdb_types.h"
 #include "statement.h"
@@ -35,6 +36,7 @@ class StoreObserver;
 namespace OHOS::NativeRdb {
 class RdbStoreConfig;
 class Statement;
+class SlaveReplicator;
 class Connection {
 public:
     using Info = DistributedRdb::RdbDebugInfo;
@@ -82,6 +84,16 @@ public:
     virtual bool IsWriter() const = 0;
     virtual int32_t ResetKey(const RdbStoreConfig &config) = 0;
     virtual int32_t TryCheckPoint(bool timeout) = 0;
+    // runs the checkpoint deferred by TryCheckPoint, the pool calls it while the writer is idle.
+    virtual int32_t IdleCheckPoint()
+    {
+        return E_NOT_SUPPORT;
+    }
+    // shares the slave replication of the pool with the writer.
+    virtual int32_t SetReplicator(std::shared_ptr<SlaveReplicator> replicator)
+    {
+        return E_NOT_SUPPORT;
+    }
     virtual int32_t LimitWalSize() = 0;
     virtual int32_t ConfigLocale(const std::string &localeStr) = 0;
     virtual int32_t SetTokenizer(Tokenizer tokenizer) = 0;
@@ -16,6 +16,7 @@
 #ifndef NATIVE_RDB_SQLITE_CONNECTION_POOL_H
 #define NATIVE_RDB_SQLITE_CONNECTION_POOL_H
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -111,10 +112,11 @@ private:
         using Creator = std::function<std::pair<int32_t, std::shared_ptr<Connection>>()>;
         static constexpr int32_t MAX_RIGHT = 0x4FFFFFFF;
         static constexpr int32_t MIN_TRANS_ID = 10000;
+        static constexpr int32_t MAX_SLOTS = 64;
         bool disable_ = true;
         int max_ = 0;
         int total_ = 0;
-        int count_ = 0;
+        std::atomic<int> count_ = 0;
         int32_t left_ = 0;
         int32_t right_ = 0;
         std::chrono::seconds timeout_;
@@ -123,6 +125,13 @@ private:
         std::mutex mutex_;
         std::condition_variable cond_;
         Creator creator_ = nullptr;
+        // the idle nodes out of nodes_, a node is released to the slot of the thread and acquired without the lock.
+        std::array<std::atomic<std::shared_ptr<ConnNode> *>, MAX_SLOTS> slots_ {};
+        std::atomic<int32_t> slotNum_ = 0;
+        std::atomic<int32_t> slotted_ = 0;
+        std::atomic<int32_t> minId_ = 0;
+        std::atomic<int32_t> waiters_ = 0;
+        ~Container();
         std::pair<int32_t, std::shared_ptr<ConnNode>> Initialize(
             Creator creator, int32_t max, int32_t timeout, bool disable, bool acquire = false);
         int32_t ConfigLocale(const std::string &locale);
@@ -146,12 +155,16 @@ private:
     private:
         int32_t ExtendNode();
         int32_t RelDetails(std::shared_ptr<ConnNode> node);
+        std::shared_ptr<ConnNode> AcquireSlot();
+        bool ReleaseSlot(std::shared_ptr<ConnNode> &node);
+        void ReclaimSlots();
     };
 
     std::pair<int32_t, SharedConns> AcquireContainer(Container &container, std::chrono::milliseconds remain);
 
     explicit ConnectionPool(std::shared_ptr<RdbStoreConfig> configHolder, const RdbStoreConfig &storeConfig);
     std::pair<int32_t, std::shared_ptr<Connection>> Init(bool isAttach = false, bool needWriter = false);
+    std::pair<int32_t, std::shared_ptr<Connection>> CreateWriter(bool isAttach);
     int32_t GetMaxReaders(const RdbStoreConfig &config);
     std::shared_ptr<Connection> Convert2AutoConn(std::shared_ptr<ConnNode> node, bool isTrans = false);
     void ReleaseNode(std::shared_ptr<ConnNode> node, bool reuse = true);
@@ -161,8 +174,12 @@ private:
     bool CheckIntegrity(const std::string &dbPath);
     void DelayClearTrans();
     void ClearCache();
+    void ScheduleCheckPoint();
+    void IdleCheckPoint();
 
     static constexpr uint32_t CHECK_POINT_INTERVAL = 5; // 5 min
+    // the idle checkpoint only takes the writer which is not in use.
+    static constexpr std::chrono::milliseconds IDLE_ACQUIRE_TIME = std::chrono::milliseconds(1);
     static constexpr int LIMITATION = 1024;
     static constexpr uint32_t ITER_V1 = 5000;
     static constexpr uint32_t ITERS_COUNT = 2;
@@ -179,6 +196,8 @@ private:
     Container readers_;
     Container trans_;
     int32_t maxReader_ = 0;
+    // the slave replication shared by the writers, only for the asynchronous replication.
+    std::shared_ptr<SlaveReplicator> replicator_;
 
     std::stack<BaseTransaction> transactionStack_;
     std::mutex transactionStackMutex_;
@@ -188,6 +207,7 @@ private:
     bool isAttach_ = false;
     std::atomic<bool> isInTransaction_ = false;
     std::atomic<bool> transEnable_ = true;
+    std::atomic<bool> isCheckPointing_ = false;
     std::atomic<uint32_t> transCount_ = 0;
     std::atomic<std::chrono::steady_clock::time_point> failedTime_;
 };
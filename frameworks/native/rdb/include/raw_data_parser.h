@@ -16,6 +16,8 @@
 #ifndef OHOS_DISTRIBUTED_DATA_RELATIONAL_STORE_FRAMEWORKS_NATIVE_RDB_PARSER_H
 #define OHOS_DISTRIBUTED_DATA_RELATIONAL_STORE_FRAMEWORKS_NATIVE_RDB_PARSER_H
 
+#include <atomic>
+
 #include "serializable.h"
 #include "traits.h"
 #include "value_object.h"
@@ -25,6 +27,13 @@ public:
     using Asset = ValueObject::Asset;
     using Assets = ValueObject::Assets;
     using Floats = ValueObject::FloatVector;
+    // The format of the assets written by PackageRawData, the parsers read all of them.
+    enum AssetFormat : int32_t {
+        // the JSON format of the earlier releases, which all the readers know.
+        ASSET_FORMAT_JSON = 0,
+        // the binary format, only for the devices whose readers are all of this release or later.
+        ASSET_FORMAT_BINARY,
+    };
     template<typename T, typename... Rest>
     static bool Convert(T input, std::variant<Rest...> &output);
 
@@ -33,12 +42,20 @@ public:
     static size_t ParserRawData(const uint8_t *data, size_t length, std::map<std::string, Asset> &assets);
     static size_t ParserRawData(const uint8_t *data, size_t length, BigInteger &bigint);
     static size_t ParserRawData(const uint8_t *data, size_t length, Floats &floats);
+    // Locates the floats of the raw data in place, values may be unaligned.
+    static size_t ParserRawData(const uint8_t *data, size_t length, const uint8_t *&values, uint32_t &count);
 
     static std::vector<uint8_t> PackageRawData(const Asset &asset);
     static std::vector<uint8_t> PackageRawData(const Assets &assets);
     static std::vector<uint8_t> PackageRawData(const std::map<std::string, Asset> &assets);
     static std::vector<uint8_t> PackageRawData(const BigInteger &bigint);
     static std::vector<uint8_t> PackageRawData(const Floats &floats);
+    static std::vector<uint8_t> PackageJsonRawData(const Asset &asset);
+    static std::vector<uint8_t> PackageJsonRawData(const Assets &assets);
+    static std::vector<uint8_t> PackageBinaryRawData(const Asset &asset);
+    static std::vector<uint8_t> PackageBinaryRawData(const Assets &assets);
+    // JSON by default, the build sets RDB_BINARY_ASSET to write the binary format.
+    static void SetAssetFormat(AssetFormat format);
 
 private:
     struct InnerAsset : public Serializable {
@@ -49,6 +66,13 @@ private:
         bool Unmarshal(const json &node) override;
     };
 
+    static size_t ParserJsonAsset(const uint8_t *data, size_t length, Asset &asset);
+    static size_t ParserBinaryAsset(const uint8_t *data, size_t length, Asset &asset);
+    static size_t ParserJsonAssets(const uint8_t *data, size_t length, Assets &assets);
+    static size_t ParserBinaryAssets(const uint8_t *data, size_t length, Assets &assets);
+    static void PackageBinaryAsset(const Asset &asset, std::vector<uint8_t> &rawData);
+    static void CheckExpires(Asset &asset);
+
     template<typename T, typename O>
     static bool Get(T &&input, O &output)
     {
@@ -68,8 +92,15 @@ private:
 
     static constexpr const uint32_t ASSET_MAGIC = 0x41534554;
     static constexpr const uint32_t ASSETS_MAGIC = 0x41534553;
+    // The binary format: magic, uint16 encoding version, uint32 payload length, then the length-prefixed fields.
+    // The fields of the later versions are appended to the payload, so the older readers skip them by the length.
+    static constexpr const uint32_t ASSET_BIN_MAGIC = 0x41534232;
+    // magic, uint16 encoding version, uint32 count, then the assets.
+    static constexpr const uint32_t ASSETS_BIN_MAGIC = 0x41535332;
+    static constexpr const uint16_t BIN_VERSION = 1;
     static constexpr const uint32_t FLOUT32_ARRAY = 0x46333241;
     static constexpr const uint32_t BIG_INT = 0x42494749;
+    static std::atomic<int32_t> assetFormat_;
 };
 
 template<typename T, typename... Rest>
@@ -46,11 +46,19 @@ public:
         STEP_TRANS_END,
         STEP_BUTT,
     };
+    struct StmtCacheStat {
+        std::atomic<uint64_t> hits_ = 0;
+        std::atomic<uint64_t> misses_ = 0;
+    };
     API_EXPORT static int Subscribe(const std::string &storeId, std::shared_ptr<SqlObserver> observer);
     API_EXPORT static int Unsubscribe(const std::string &storeId, std::shared_ptr<SqlObserver> observer);
     static uint32_t GenerateId();
     static void Pause(uint32_t seqId = 0);
     static void Resume(uint32_t seqId = 0);
+    // The prepared statement caches of all connections of the store count into the same stat.
+    static std::shared_ptr<StmtCacheStat> GetStmtCacheStat(const std::string &storeId);
+    // Gets the hits and misses of the statement caches of the store while any of its connections is open.
+    API_EXPORT static std::pair<uint64_t, uint64_t> GetStmtCacheCounts(const std::string &storeId);
 
     ~PerfStat();
     PerfStat(const std::string &storeId, const std::string &sql, int32_t step, uint32_t seqId = 0, size_t size = 0);
@@ -71,6 +79,7 @@ private:
     static std::atomic_uint32_t seqId_;
     static std::shared_mutex mutex_;
     static std::map<uint64_t, ThreadParam> threadParams_;
+    static ConcurrentMap<std::string, std::weak_ptr<StmtCacheStat>> stmtCacheStats_;
 
     int32_t step_ = 0;
     uint64_t key_ = 0;
@@ -111,6 +111,8 @@ public:
         const ReturningConfig &config, Resolution resolution) override;
     std::pair<int32_t, Results> Delete(const AbsRdbPredicates &predicates, const ReturningConfig &config) override;
     std::shared_ptr<AbsSharedResultSet> QuerySql(const std::string &sql, const Values &args) override;
+    std::shared_ptr<AbsSharedResultSet> QuerySql(
+        const std::string &sql, const Values &args, const QueryOptions &options) override;
     std::shared_ptr<ResultSet> QueryByStep(
         const std::string &sql, const Values &args, const QueryOptions &options) override;
     std::shared_ptr<ResultSet> RemoteQuery(
@@ -283,12 +285,11 @@ private:
     std::pair<int32_t, Results> ExecuteForRow(const std::string &sql, const Values &args,
         const ReturningConfig &config = {}, const std::string &returningSql = "");
     std::pair<int32_t, Results> GenerateResult(int32_t code, std::shared_ptr<Statement> statement,
-        std::vector<ValuesBucket> &&returningValues, bool isDML, int32_t rowIndex = ReturningConfig::FIRST_ROW_INDEX);
+        ReturningRows &&returningRows, bool isDML, int32_t rowIndex = ReturningConfig::FIRST_ROW_INDEX);
     int32_t HandleSchemaDDL(std::shared_ptr<Statement> &&statement, const std::string &sql);
-    using BatchSqlArgs =
-        std::vector<std::pair<std::string, std::vector<std::vector<std::reference_wrapper<ValueObject>>>>>;
-    std::pair<int32_t, Results> ExecuteBatchInsertReturning(const BatchSqlArgs &sqlArgs,
-        const std::shared_ptr<Connection> &conn, const ReturningConfig &config, Resolution resolution);
+    std::pair<int32_t, Results> ExecuteBatchInsertReturning(const std::string &sql,
+        const std::vector<std::reference_wrapper<ValueObject>> &args, const std::shared_ptr<Connection> &conn,
+        const ReturningConfig &config, Resolution resolution);
     void BatchInsertArgsDfx(int argsSize);
     void SetKnowledgeSchema();
     std::shared_ptr<NativeRdb::KnowledgeSchemaHelper> GetKnowledgeSchemaHelper();
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_SHARED_BLOCK_POOL_H
+#define NATIVE_RDB_SHARED_BLOCK_POOL_H
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "shared_block.h"
+#include "task_executor.h"
+
+namespace OHOS {
+namespace NativeRdb {
+/**
+ * @brief Process-wide pool of the shared blocks, grouped by the power-of-two size classes.
+ * The blocks live in the process memory and move to the shared memory only when they are handed out, so the
+ * local queries take no file descriptor. The block acquired from the pool returns to it when the last reference
+ * is released, unless it has been handed out. The idle blocks are freed after IDLE_TIMEOUT or over MAX_IDLE_BYTES.
+ */
+class SharedBlockPool {
+public:
+    using SharedBlock = AppDataFwk::SharedBlock;
+    using Time = std::chrono::steady_clock::time_point;
+    struct Stats {
+        size_t idleBlocks = 0;
+        size_t idleBytes = 0;
+        size_t usingBlocks = 0;
+        size_t usingBytes = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t trimmed = 0;
+    };
+    static constexpr size_t MIN_CLASS_SIZE = 128 * 1024;
+    static constexpr size_t MAX_CLASS_SIZE = 8 * 1024 * 1024;
+    static constexpr size_t MAX_IDLE_BYTES = 16 * 1024 * 1024;
+    static constexpr std::chrono::seconds IDLE_TIMEOUT = std::chrono::seconds(30);
+
+    static SharedBlockPool &GetInstance();
+    std::pair<int, std::shared_ptr<SharedBlock>> Acquire(const std::string &name, size_t size);
+    void Trim(bool force = false);
+    Stats GetStats();
+
+private:
+    struct Idle {
+        SharedBlock *block = nullptr;
+        Time time;
+    };
+
+    SharedBlockPool() = default;
+    ~SharedBlockPool() = default;
+    static size_t GetClassSize(size_t size);
+    void Release(SharedBlock *block);
+    void ScheduleTrim();
+
+    std::mutex mutex_;
+    // the back of each list is the most recently released block.
+    std::map<size_t, std::list<Idle>> idles_;
+    Stats stats_;
+    TaskExecutor::TaskId trimTaskId_ = TaskExecutor::INVALID_TASK_ID;
+};
+} // namespace NativeRdb
+} // namespace OHOS
+#endif // NATIVE_RDB_SHARED_BLOCK_POOL_H
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_SLAVE_REPLICATOR_H
+#define NATIVE_RDB_SLAVE_REPLICATOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "task_executor.h"
+#include "value_object.h"
+
+namespace OHOS {
+namespace NativeRdb {
+class SqliteConnection;
+/**
+ * @brief Replays the writes of the HA main database on its slave database in the background.
+ * The statements are captured after they succeeded on the main database, grouped by the main transaction and
+ * applied in commit order by the task executor, so the commit path does not wait for the slave any more.
+ * The connection pool owns one replicator, all of its writers (the writer and the transaction connections) record
+ * to it and it replays on the slave connection of the writer attached last, so a reopened writer replaces the
+ * slave connection of the closed one. Each writer records its open transaction by its own Recorder, which hands
+ * the whole transaction to the replicator when it is over, so the overlapping transactions never mix.
+ *
+ * Covered writes: every statement of the writers, Execute, ExecuteForValue, ExecuteForRows and ExecuteForReturning
+ * (so the single and the batch inserts, updates, deletes and the sql executed by the user), and the writing
+ * statements driven by Bind and Step. The binlog and the backup are not replayed, the backup suspends the
+ * replicator instead.
+ *
+ * Crash consistency: the main database always commits first, the slave lags behind it by at most MAX_PENDING_OPS
+ * statements. The slave is marked interrupted while any committed write is not replayed yet and the mark is
+ * removed once the queue is drained, so after a crash in between the slave is rebuilt by a full backup as an
+ * interrupted backup would be. A failed replay or a full queue marks the slave invalid like the binlog replay.
+ * The statements are replayed as written, the non-deterministic sql (random(), current time) may diverge, the
+ * binlog is preferred whenever it is supported.
+ */
+class SlaveReplicator : public std::enable_shared_from_this<SlaveReplicator> {
+public:
+    using Time = std::chrono::steady_clock::time_point;
+    using Values = std::vector<std::reference_wrapper<ValueObject>>;
+    struct Stats {
+        size_t pendingUnits = 0;
+        size_t pendingOps = 0;
+        uint64_t appliedUnits = 0;
+        uint64_t droppedUnits = 0;
+        // the age of the oldest committed write which is not on the slave yet.
+        int64_t lagMs = 0;
+    };
+    static constexpr size_t MAX_PENDING_OPS = 10000;
+    class Recorder;
+
+    explicit SlaveReplicator(const std::string &path);
+    void Attach(std::shared_ptr<SqliteConnection> slave);
+    int32_t Flush();
+    // the writes committed between Suspend and Resume are not replayed, the backup copies them.
+    void Suspend();
+    void Resume();
+    Stats GetStats();
+
+private:
+    struct Op {
+        std::string sql;
+        std::vector<ValueObject> args;
+        int type = 0;
+    };
+    struct Unit {
+        std::vector<Op> ops;
+        Time time;
+    };
+
+    static bool IsGroupable(const Unit &unit);
+    bool Hold(std::vector<Op> &ops);
+    void Commit(std::vector<Op> &&ops);
+    void Schedule();
+    int32_t Apply(bool isFlush);
+    int32_t ApplyUnits(std::list<Unit> &units);
+    int32_t ApplyGroup(std::list<Unit>::iterator begin, std::list<Unit>::iterator end);
+    int32_t Execute(const std::string &sql, const std::vector<ValueObject> &args = {});
+    void Abandon();
+    void ClearMark();
+
+    std::mutex mutex_;
+    // serializes the replay on the slave connection.
+    std::mutex applyMutex_;
+    std::string path_;
+    std::shared_ptr<SqliteConnection> slave_;
+    std::list<Unit> units_;
+    size_t pendingOps_ = 0;
+    size_t applyingUnits_ = 0;
+    size_t applyingOps_ = 0;
+    Time applyingTime_;
+    int32_t suspended_ = 0;
+    bool invalid_ = false;
+    bool marked_ = false;
+    uint64_t appliedUnits_ = 0;
+    uint64_t droppedUnits_ = 0;
+    TaskExecutor::TaskId taskId_ = TaskExecutor::INVALID_TASK_ID;
+};
+
+/**
+ * @brief Records the writes of one writer connection, it is used by the connection only.
+ */
+class SlaveReplicator::Recorder {
+public:
+    explicit Recorder(std::shared_ptr<SlaveReplicator> replicator);
+    void Append(const std::string &sql, const Values &args, bool readOnly, bool autoCommit);
+
+private:
+    std::shared_ptr<SlaveReplicator> replicator_;
+    // the statements of the open transaction of the connection on the main database.
+    std::vector<Op> current_;
+};
+} // namespace NativeRdb
+} // namespace OHOS
+#endif // NATIVE_RDB_SLAVE_REPLICATOR_H
@@ -27,8 +27,10 @@
 #include "concurrent_map.h"
 #include "connection.h"
 #include "rdb_store_config.h"
+#include "slave_replicator.h"
 #include "sqlite3sym.h"
 #include "sqlite_statement.h"
+#include "sqlite_statement_cache.h"
 #include "value_object.h"
 
 typedef struct ClientChangedData ClientChangedData;
@@ -56,6 +58,8 @@ public:
     int32_t VerifyAndRegisterHook(const RdbStoreConfig &config) override;
     void Interrupt() override;
     int TryCheckPoint(bool timeout) override;
+    int32_t IdleCheckPoint() override;
+    int32_t SetReplicator(std::shared_ptr<SlaveReplicator> replicator) override;
     int LimitWalSize() override;
     int ConfigLocale(const std::string &localeStr) override;
     int32_t SetTokenizer(Tokenizer tokenizer) override;
@@ -119,6 +123,10 @@ private:
     int SetJournalMode(const RdbStoreConfig &config);
     int SetEncryptAgo(const RdbStoreConfig::CryptoParam &cryptoParam);
     int SetAutoCheckpoint(const RdbStoreConfig &config);
+    int SetWalHook(const RdbStoreConfig &config);
+    int GetCheckPointMode(ssize_t &size) const;
+    int CheckPoint(int mode, ssize_t size);
+    std::shared_ptr<Connection> AutoCheckSlave(bool timeout);
     int SetWalFile(const RdbStoreConfig &config);
     int SetWalSyncMode(const std::string &syncMode);
     int SetTokenizer(const RdbStoreConfig &config);
@@ -176,6 +184,7 @@ private:
     static void ReplayBinlog(const std::string &dbPath, std::shared_ptr<SqliteConnection> slaveConn, bool isNeedClean);
     static std::string GetBinlogFolderPath(const std::string &dbPath);
     static Connection::ReplayCallBack GetReplayCallback(const std::string &dbPath);
+    static int OnWalCommit(void *arg, sqlite3 *db, const char *dbName, int frames);
     /**
      * @brief The lifecycle of config must be shorter than that of param..
      */
@@ -188,6 +197,8 @@ private:
         { ".corruptedflg", nullptr }, { "-compare", nullptr }, { "-walcompress", nullptr },
         { "-journalcompress", nullptr }, { "-shmcompress", nullptr }, { "-lockcompress", nullptr } };
     static constexpr int CHECKPOINT_TIME = 500;
+    static constexpr int CHECKPOINT_NONE = -1;
+    static constexpr int WAL_FRAME_HEADER_SIZE = 24;
     static constexpr int DEFAULT_BUSY_TIMEOUT_MS = 2000;
     static constexpr int BACKUP_PAGES_PRE_STEP = 12800; // 1024 * 4 * 12800 == 50m
     static constexpr int BACKUP_ALL_STEP = -1;
@@ -211,6 +222,15 @@ private:
     static const int32_t regOpenSSLCleaner_;
     static const int32_t regRekeyExcuter_;
     static ConcurrentMap<uint64_t, ReplayCallBack> replayCallback_;
+    // the wal frames reported by the wal hook, shared by the writer connections of the same database.
+    struct WalState {
+        std::atomic<int32_t> frames = 0;
+        std::atomic<int32_t> ckptFrames = 0;
+        std::atomic<int32_t> peakFrames = 0;
+    };
+    static std::shared_ptr<WalState> GetWalState(const std::string &path);
+    static std::mutex walStatesMutex_;
+    static std::map<std::string, std::weak_ptr<WalState>> walStates_;
     using EventHandle = int (SqliteConnection::*)();
     struct HandleInfo {
         RegisterType Type;
@@ -233,9 +253,18 @@ private:
     bool isSupportBinlog_ = false;
     bool isSlave_ = false;
     bool isReplay_ = false;
+    // false once the wal hook is taken over by RegisterDbHook, the wal file size is checked instead.
+    std::atomic<bool> walHooked_ = false;
+    int32_t autoCheckpoint_ = 0;
+    int64_t frameSize_ = 0;
+    std::shared_ptr<WalState> walState_;
     JournalMode mode_ = JournalMode::MODE_WAL;
     int maxVariableNumber_;
     std::shared_ptr<SqliteConnection> slaveConnection_;
+    std::shared_ptr<SqliteStatementCache> stmtCache_;
+    std::shared_ptr<SlaveReplicator> replicator_;
+    // the writes of this connection, the other writers of the pool record to the same replicator by their own.
+    std::shared_ptr<SlaveReplicator::Recorder> recorder_;
     std::map<std::string, ScalarFunctionInfo> customScalarFunctions_;
     const RdbStoreConfig config_;
     bool isReleaseTempSlaveConn_ = false;
@@ -19,7 +19,9 @@
 #include <sqlite3.h>
 
 #include <map>
+#include <vector>
 
+#include "result_set.h"
 #include "value_object.h"
 
 namespace OHOS {
@@ -41,10 +43,23 @@ private:
     static void SqliteResultError(sqlite3_context *ctx, const int &errCode, const std::string &msg);
     static int32_t IntegrityCheck(sqlite3 *dbHandle);
     static int32_t BackUpDB(sqlite3 *source, sqlite3 *dest);
+    struct VectorArgs {
+        Float32View lhs;
+        Float32View rhs;
+        std::vector<float> buffers[2];
+    };
+    static void L2Distance(sqlite3_context *ctx, int argc, sqlite3_value **argv);
+    static void InnerProduct(sqlite3_context *ctx, int argc, sqlite3_value **argv);
+    static void CosineDistance(sqlite3_context *ctx, int argc, sqlite3_value **argv);
+    static bool GetVectors(sqlite3_context *ctx, int argc, sqlite3_value **argv, VectorArgs &args);
+    static bool GetVector(sqlite3_value *value, std::vector<float> &buffer, Float32View &view);
     static constexpr SqliteFunction FUNCTIONS[] = {
         { "merge_assets", 2, &SqliteFunctionRegistry::MergeAssets },
         { "merge_asset", 2, &SqliteFunctionRegistry::MergeAsset },
         { "import_db_from_path", 1, &SqliteFunctionRegistry::ImportDB },
+        { "l2_distance", 2, &SqliteFunctionRegistry::L2Distance },
+        { "inner_product", 2, &SqliteFunctionRegistry::InnerProduct },
+        { "cosine_distance", 2, &SqliteFunctionRegistry::CosineDistance },
     };
 
 public:
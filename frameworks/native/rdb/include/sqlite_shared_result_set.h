@@ -17,6 +17,8 @@
 #define NATIVE_RDB_SQLITE_SHARED_RESULT_SET_H
 
 #include <chrono>
+#include <condition_variable>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -25,6 +27,8 @@
 
 #include "abs_shared_result_set.h"
 #include "connection.h"
+#include "rdb_errno.h"
+#include "rdb_types.h"
 #include "shared_block.h"
 #include "statement.h"
 #include "value_object.h"
@@ -36,22 +40,52 @@ public:
     using Values = std::vector<ValueObject>;
     using Conn = std::shared_ptr<Connection>;
     using Time = std::chrono::steady_clock::time_point;
-    SqliteSharedResultSet(Time start, Conn conn, std::string sql, const Values &args, const std::string &path);
+    using QueryOptions = DistributedRdb::QueryOptions;
+    struct BlockCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t blocks = 0;
+        size_t bytes = 0;
+    };
+    SqliteSharedResultSet(Time start, Conn conn, std::string sql, const Values &args, const std::string &path,
+        const QueryOptions &options = QueryOptions());
     ~SqliteSharedResultSet() override;
     int Close() override;
+    int GetRowCount(int &count) override;
+    int GoToRow(int position) override;
     int32_t OnGo(int oldPosition, int newPosition) override;
     void SetBlock(AppDataFwk::SharedBlock *block) override;
     int PickFillBlockStartPosition(int resultSetPosition, int blockCapacity) const;
     void SetFillBlockForwardOnly(bool isOnlyFillResultSetBlockInput);
+    BlockCacheStats GetBlockCacheStats();
 
 protected:
     void Finalize() override;
     std::pair<int, std::vector<std::string>> GetColumnNames() override;
 
 private:
+    // The fill of the block after the current one, it owns the block until the consumer takes it.
+    struct PrefetchTask {
+        enum Status : int32_t { PENDING, RUNNING, DONE, CANCELED };
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::shared_ptr<AppDataFwk::SharedBlock> block;
+        int32_t status = PENDING;
+        int32_t errCode = E_OK;
+        bool isFull = true;
+        int totalRows = 0;
+    };
+
     std::pair<std::shared_ptr<Statement>, int> PrepareStep();
     int32_t FillBlock(int requiredPos);
     int32_t ExecuteForSharedBlock(AppDataFwk::SharedBlock *block, int start, int required);
+    void SchedulePrefetch(const std::shared_ptr<AppDataFwk::SharedBlock> &block);
+    void WaitPrefetch();
+    bool TakePrefetch(int requiredPos);
+    bool TakeCachedBlock(int requiredPos);
+    void SwitchBlock(std::shared_ptr<AppDataFwk::SharedBlock> block);
+    std::shared_ptr<AppDataFwk::SharedBlock> AcquireFreeBlock(AppDataFwk::SharedBlock &current);
+    void RecycleBlock(std::shared_ptr<AppDataFwk::SharedBlock> block, bool isCache);
 
 private:
     // The specified value is -1 when there is no data
@@ -62,17 +96,31 @@ private:
     static const int MAX_RETRY_TIMES = 50;
     // Interval of retrying query in millisecond
     static const int RETRY_INTERVAL = 1000;
+    // The prefetch is skipped when the shared blocks in use of the process are over it
+    static constexpr size_t MAX_PREFETCH_BYTES = 32 * 1024 * 1024;
     // Controls fetching of rows relative to requested position
     bool isOnlyFillBlock_ = false;
+    // The row count is not calculated when query, it is learned from the fill that reaches the end or GetRowCount
+    bool isLazyCount_ = false;
     uint32_t blockCapacity_ = 0;
     // The number of rows in the cursor
     int rowNum_ = NO_COUNT;
+    bool isPrefetch_ = false;
+    // The bytes of the filled blocks kept besides the current one, 0 to disable the cache
+    size_t blockCacheBudget_ = 0;
 
     std::shared_ptr<Connection> conn_;
     std::shared_ptr<Statement> statement_;
     std::string qrySql_;
     std::vector<ValueObject> bindArgs_;
+    // Guards prefetch_, spareBlock_ and the block cache.
     std::mutex mutex_;
+    std::shared_ptr<PrefetchTask> prefetch_;
+    // The second block of the rotation, filled by the next prefetch.
+    std::shared_ptr<AppDataFwk::SharedBlock> spareBlock_;
+    // The filled blocks visited recently, the front is the most recent one.
+    std::list<std::shared_ptr<AppDataFwk::SharedBlock>> cachedBlocks_;
+    BlockCacheStats cacheStats_;
 };
 } // namespace NativeRdb
 } // namespace OHOS
@@ -27,7 +27,12 @@ namespace NativeRdb {
 class SqliteSqlBuilder {
 public:
     using RefValue = std::reference_wrapper<ValueObject>;
-    using BatchRefSqls = std::vector<std::pair<std::string, std::vector<std::vector<RefValue>>>>;
+    struct BatchSql {
+        std::string sql;
+        // the rows bound to each execution of the sql, and how many times it is executed.
+        size_t rows = 0;
+        size_t times = 0;
+    };
     SqliteSqlBuilder();
     ~SqliteSqlBuilder();
     static int BuildQueryString(bool distinct, const std::string &table, const std::string &joinClause,
@@ -46,13 +51,15 @@ public:
 
     static std::string GetReturningSql(const std::vector<std::string> &fields);
 
-    static BatchRefSqls GenerateSqls(const std::string &table, const ValuesBuckets &buckets, int limit,
-        ConflictResolution resolution = ConflictResolution::ON_CONFLICT_REPLACE);
+    static std::vector<BatchSql> GenerateBatchSqls(const std::string &table, const ValuesBuckets &buckets,
+        int limit, ConflictResolution resolution = ConflictResolution::ON_CONFLICT_REPLACE);
+    static void FillBatchArgs(const ValuesBuckets &buckets, size_t begin, size_t rows, std::vector<RefValue> &args);
     static void UpdateAssetStatus(const ValueObject &value, int32_t status);
 
 private:
-    static BatchRefSqls MakeExecuteSqls(
-        const std::string &sql, const std::vector<RefValue> &args, int fieldSize, int limit);
+    static std::string GetInsertHeader(
+        const std::string &table, const ValuesBuckets::FieldsType &fields, ConflictResolution resolution);
+    static std::string GetBatchSql(const std::string &header, size_t fieldSize, size_t rows);
     static void AppendClause(
         std::string &builder, const std::string &name, const std::string &clause, const std::string &table = "");
     static void AppendColumns(
@@ -21,7 +21,9 @@
 
 #include "rdb_store_config.h"
 #include "share_block.h"
+#include "slave_replicator.h"
 #include "sqlite3sym.h"
+#include "sqlite_statement_cache.h"
 #include "sqlite_utils.h"
 #include "statement.h"
 #include "value_object.h"
@@ -50,6 +52,10 @@ public:
         const std::vector<ValueObject> &args, int32_t maxCount) override;
     std::pair<int, std::vector<ValuesBucket>> ExecuteForRows(
         const std::vector<std::reference_wrapper<ValueObject>> &args, int32_t maxCount) override;
+    std::pair<int, ReturningRows> ExecuteForReturning(
+        const std::vector<ValueObject> &args, int32_t maxCount) override;
+    std::pair<int, ReturningRows> ExecuteForReturning(
+        const std::vector<std::reference_wrapper<ValueObject>> &args, int32_t maxCount) override;
     int Changes() const override;
     int64_t LastInsertRowId() const override;
     int32_t GetColumnCount() const override;
@@ -58,6 +64,7 @@ public:
     std::pair<int32_t, size_t> GetSize(int index) const override;
     std::pair<int32_t, ValueObject> GetColumn(int index) const override;
     std::pair<int32_t, std::vector<ValuesBucket>> GetRows(int32_t maxCount) override;
+    int32_t FetchRow(ColumnBatch &batch) const override;
     bool ReadOnly() const override;
     bool SupportBlockInfo() const override;
     int32_t FillBlockInfo(SharedBlockInfo *info, int retryTime = RETRY_TIME) const override;
@@ -67,21 +74,34 @@ public:
 
 private:
     friend class SqliteConnection;
+    // unbinds the args bound by SQLITE_STATIC when the guard goes out of scope.
+    class UnbindGuard {
+    public:
+        UnbindGuard(SqliteStatement &statement, bool isStatic);
+        ~UnbindGuard();
+        UnbindGuard(const UnbindGuard &) = delete;
+        UnbindGuard &operator=(const UnbindGuard &) = delete;
+
+    private:
+        SqliteStatement &statement_;
+        bool isStatic_;
+    };
     using Asset = ValueObject::Asset;
     using Assets = ValueObject::Assets;
     using BigInt = ValueObject::BigInt;
     using Floats = ValueObject::FloatVector;
-    using Action = int32_t (*)(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindNil(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindInteger(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindDouble(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindText(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindBool(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindBlob(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindAsset(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindAssets(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindFloats(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
-    static int32_t BindBigInt(sqlite3_stmt *stat, int index, const ValueObject::Type &object);
+    using Destructor = sqlite3_destructor_type;
+    using Action = int32_t (*)(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindNil(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindInteger(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindDouble(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindText(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindBool(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindBlob(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindAsset(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindAssets(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindFloats(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
+    static int32_t BindBigInt(sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor);
     static const int SQLITE_SET_SHAREDBLOCK = 2004;
     static const int SQLITE_USE_SHAREDBLOCK = 2005;
     static constexpr Action ACTIONS[ValueObject::TYPE_MAX] = { BindNil, BindInteger, BindDouble, BindText, BindBool,
@@ -90,12 +110,21 @@ private:
     int CheckEnvironment(int paramCount) const;
     int CheckValueObjectValid(const ValueObject &obj, int paramPos, size_t totalParams) const;
     int Prepare(sqlite3 *dbHandle, const std::string &sql);
-    int BindArgs(const std::vector<ValueObject> &bindArgs);
-    int BindArgs(const std::vector<std::reference_wrapper<ValueObject>> &bindArgs);
+    int BindArgs(const std::vector<ValueObject> &bindArgs, bool isStatic = false);
+    // the text and blob are bound by SQLITE_STATIC when isStatic, the args must outlive the steps.
+    int BindArgs(const std::vector<std::reference_wrapper<ValueObject>> &bindArgs, bool isStatic = false);
+    void UnbindArgs();
     int IsValid(int index) const;
     int InnerStep();
+    void Replicate(const std::vector<std::reference_wrapper<ValueObject>> &args);
+    int HandleStepResult(int errCode);
+    std::pair<int32_t, ReturningRows> StepRows(int32_t maxCount);
+    std::pair<int32_t, ValueObject> GetRowValue(int32_t index, std::vector<int32_t> &blobTypes) const;
     int InnerFinalize();
+    void RefreshColumnInfo() const;
     ValueObject GetValueFromBlob(int32_t index, int32_t type) const;
+    // stricter than GetValueFromBlob for the RETURNING rows: keeps the empty blob and fails the corrupt raw data.
+    std::pair<int32_t, ValueObject> GetReturningBlob(int32_t index, int32_t type) const;
     void ReadFile2Buffer();
     void PrintInfoForDbError(int errCode, const std::string &sql);
     void TableReport(const std::string &errMsg, const std::string &bundleName, ErrMsgState state);
@@ -111,14 +140,21 @@ private:
 
     bool readOnly_;
     bool bound_ = false;
-    int columnCount_ = -1;
+    mutable int columnCount_ = -1;
+    mutable int reprepareCount_ = 0;
     int numParameters_;
     uint32_t seqId_ = 0;
+    uint64_t generation_ = 0;
     sqlite3_stmt *stmt_;
     std::shared_ptr<Connection> conn_;
     std::string sql_;
     mutable std::vector<int32_t> types_;
     std::shared_ptr<Statement> slave_;
+    std::shared_ptr<SlaveReplicator::Recorder> recorder_;
+    std::string replicaSql_;
+    // the args bound by Bind, the writes driven by Step are replicated with them.
+    std::vector<ValueObject> replicaArgs_;
+    std::shared_ptr<SqliteStatementCache> cache_;
     const RdbStoreConfig *config_ = nullptr;
 };
 } // namespace NativeRdb
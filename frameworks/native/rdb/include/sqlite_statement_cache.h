@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_SQLITE_STATEMENT_CACHE_H
+#define NATIVE_RDB_SQLITE_STATEMENT_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "rdb_perfStat.h"
+#include "sqlite3sym.h"
+
+namespace OHOS {
+namespace NativeRdb {
+/**
+ * @brief Bounded LRU of the idle prepared statements of one connection, keyed by the prepared sql.
+ * Clear() finalizes them and bumps the generation, statements acquired before are finalized on release.
+ * The hits and misses are counted on the cache and on the PerfStat stat of the store too.
+ */
+class SqliteStatementCache {
+public:
+    using Stat = DistributedRdb::PerfStat::StmtCacheStat;
+    static constexpr size_t DEFAULT_CAPACITY = 32;
+
+    explicit SqliteStatementCache(std::shared_ptr<Stat> stat = nullptr, size_t capacity = DEFAULT_CAPACITY);
+    ~SqliteStatementCache();
+    std::pair<sqlite3_stmt *, uint64_t> Acquire(const std::string &sql);
+    void Release(const std::string &sql, sqlite3_stmt *stmt, uint64_t generation);
+    uint64_t GetGeneration();
+    void Clear();
+    size_t Size();
+    uint64_t GetHits() const;
+    uint64_t GetMisses() const;
+
+private:
+    using Entry = std::pair<std::string, sqlite3_stmt *>;
+
+    std::mutex mutex_;
+    size_t capacity_;
+    uint64_t generation_ = 0;
+    // the front is the most recently released statement.
+    std::list<Entry> entries_;
+    std::map<std::string, std::list<Entry>::iterator> index_;
+    std::atomic<uint64_t> hits_ = 0;
+    std::atomic<uint64_t> misses_ = 0;
+    std::shared_ptr<Stat> stat_;
+};
+} // namespace NativeRdb
+} // namespace OHOS
+#endif // NATIVE_RDB_SQLITE_STATEMENT_CACHE_H
@@ -83,7 +83,7 @@ public:
     static std::string GetSlavePath(const std::string &name);
     static std::string GetMasterBackupPath(const std::string &name);
     static int SetSlaveInvalid(const std::string &dbPath);
-    static int SetSlaveInterrupted(const std::string &dbPath);
+    static int SetSlaveInterrupted(const std::string &dbPath, bool isInterrupted = true);
     static int SetSlaveRestoring(const std::string &dbPath, bool isRestore = true);
     static bool IsSlaveRestoring(const std::string &dbPath);
     static ssize_t GetDecompressedSize(const std::string &dbPath);
@@ -146,12 +146,16 @@ private:
         { "UPD", SqliteUtils::STATEMENT_UPDATE }
     };
     static constexpr size_t TYPE_SIZE = sizeof(SQL_TYPE_MAP) / sizeof(SqlType);
+    // the anonymized sql is cached, the same statement is logged repeatedly when the errors burst.
+    static constexpr size_t SQL_ANONYMOUS_CACHE_SIZE = 128;
+    static constexpr size_t SQL_ANONYMOUS_MAX_LENGTH = 4096;
     static constexpr const char *ON_CONFLICT_CLAUSE[CONFLICT_CLAUSE_COUNT] = { "", " OR ROLLBACK", " OR ABORT",
         " OR FAIL", " OR IGNORE", " OR REPLACE" };
     static const std::unordered_map<int32_t, int> STATUS_MAP;
 
     static std::string GetAnonymousName(const std::string &fileName);
     static std::string AnonymousDigits(const std::string &digits, bool fullyAnonymize);
+    static std::string DoSqlAnonymous(const std::string &sql);
     static bool IsKeyword(const std::string& word);
     static std::string GetModeInfo(uint32_t st_mode);
     static int GetPageCountCallback(void *data, int argc, char **argv, char **azColName);
@@ -20,11 +20,21 @@
 #include <string>
 #include <vector>
 
+#include "rdb_errno.h"
 #include "rdb_types.h"
+#include "result_set.h"
 #include "value_object.h"
 #include "values_bucket.h"
 namespace OHOS::NativeRdb {
 struct SharedBlockInfo;
+/**
+ * The rows stepped out of a statement, the columns are sorted by name and deduplicated as the ValuesBucket and
+ * the values of row r are values[r * columns.size(), (r + 1) * columns.size()).
+ */
+struct ReturningRows {
+    std::vector<std::string> columns;
+    std::vector<ValueObject> values;
+};
 class Statement {
 public:
     static constexpr int32_t COLUMN_TYPE_INVALID = 0;
@@ -49,6 +59,15 @@ public:
     virtual std::pair<int, std::vector<ValuesBucket>> ExecuteForRows(
         const std::vector<std::reference_wrapper<ValueObject>> &args = {},
         int32_t maxCount = ReturningConfig::DEFAULT_RETURNING_COUNT) = 0;
+    virtual std::pair<int, ReturningRows> ExecuteForReturning(const std::vector<ValueObject> &args, int32_t maxCount)
+    {
+        return { E_NOT_SUPPORT, {} };
+    }
+    virtual std::pair<int, ReturningRows> ExecuteForReturning(
+        const std::vector<std::reference_wrapper<ValueObject>> &args, int32_t maxCount)
+    {
+        return { E_NOT_SUPPORT, {} };
+    }
     virtual int32_t Changes() const = 0;
     virtual int64_t LastInsertRowId() const = 0;
 
@@ -59,6 +78,20 @@ public:
     virtual std::pair<int32_t, ValueObject> GetColumn(int32_t index) const = 0;
     virtual std::pair<int32_t, std::vector<ValuesBucket>> GetRows(
         int32_t maxCount = ReturningConfig::DEFAULT_RETURNING_COUNT) = 0;
+    virtual int32_t FetchRow(ColumnBatch &batch) const
+    {
+        for (size_t col = 0; col < batch.columns.size(); ++col) {
+            auto [errCode, value] = GetColumn(static_cast<int32_t>(col));
+            if (errCode != E_OK) {
+                return errCode;
+            }
+            errCode = batch.columns[col].PutValue(value);
+            if (errCode != E_OK) {
+                return errCode;
+            }
+        }
+        return E_OK;
+    }
     virtual bool ReadOnly() const = 0;
     virtual bool SupportBlockInfo() const = 0;
     virtual int32_t FillBlockInfo(SharedBlockInfo *info, int retryTime = RETRY_TIME) const = 0;
@@ -69,6 +102,11 @@ public:
     }
 
     virtual std::string GetLastErrorMsg() const { return ""; }
+    // The view points into the statement and is valid until the next step, reset or finalize.
+    virtual std::pair<int32_t, Float32View> GetFloat32View(int32_t index) const
+    {
+        return { E_NOT_SUPPORT, {} };
+    }
 
     static constexpr int INVALID_COUNT = -1;
 };
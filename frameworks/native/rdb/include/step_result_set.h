@@ -16,6 +16,7 @@
 #ifndef NATIVE_RDB_STEP_RESULT_SET_H
 #define NATIVE_RDB_STEP_RESULT_SET_H
 
+#include <deque>
 #include <memory>
 #include <shared_mutex>
 #include <thread>
@@ -42,21 +43,32 @@ public:
     int GoToNextRow() override;
     int GetSize(int columnIndex, size_t &size) override;
     int Get(int32_t col, ValueObject &value) override;
+    int GetFloat32Array(int32_t index, ValueObject::FloatVector &vecs) override;
+    int GetFloat32View(int32_t index, Float32View &view) override;
     int Close() override;
     int GetRowCount(int &count) override;
 
 protected:
     std::pair<int, std::vector<std::string>> GetColumnNames() override;
+    int FetchRow(ColumnBatch &batch) override;
 
     std::string GetLastErrorMsg() const override;
 
 private:
     template<typename T>
     int GetValue(int32_t col, T &value);
+    struct Row {
+        std::vector<ValueObject> values;
+        std::vector<int32_t> types;
+        size_t bytes = 0;
+    };
     std::pair<int, ValueObject> GetValueObject(int32_t col, size_t index);
     std::shared_ptr<Statement> GetStatement();
     int Reset();
     int PrepareStep();
+    void Capture(const std::shared_ptr<Statement> &statement);
+    bool InWindow(int position) const;
+    const Row *GetWindowRow() const;
 
     // Max times of retrying step query
     static const int STEP_QUERY_RETRY_MAX_TIMES = 50;
@@ -71,6 +83,13 @@ private:
 
     std::string sql_;
     std::vector<ValueObject> args_;
+    // the row of the statement, rowPos_ is behind it when it is moved back into the window.
+    int stepPos_ = INIT_POS;
+    // the rows [windowStart_, windowStart_ + window_.size()) stepped last, within windowBudget_ bytes.
+    int windowStart_ = 0;
+    size_t windowBytes_ = 0;
+    size_t windowBudget_ = 0;
+    std::deque<Row> window_;
 };
 } // namespace NativeRdb
 } // namespace OHOS
@@ -33,6 +33,8 @@ public:
     std::pair<int32_t, Results> Delete(
         const AbsRdbPredicates &predicates, const ReturningConfig &config) override;
     std::shared_ptr<AbsSharedResultSet> QuerySql(const std::string &sql, const Values &args) override;
+    std::shared_ptr<AbsSharedResultSet> QuerySql(const std::string &sql, const Values &args,
+        const QueryOptions &options) override;
     std::shared_ptr<ResultSet> QueryByStep(const std::string &sql, const Values &args,
         const QueryOptions &options) override;
     std::pair<int32_t, ValueObject> Execute(const std::string &sql, const Values &args, int64_t trxId) override;
@@ -47,7 +49,7 @@ private:
         const std::string &sql, const std::string &returningSql = "") const;
     void HandleSchemaDDL(std::shared_ptr<Statement> statement);
     static std::pair<int32_t, Results> GenerateResult(int32_t code, std::shared_ptr<Statement> statement,
-        std::vector<ValuesBucket> &&returningValues, bool isDML, int32_t rowIndex = ReturningConfig::FIRST_ROW_INDEX);
+        ReturningRows &&returningRows, bool isDML, int32_t rowIndex = ReturningConfig::FIRST_ROW_INDEX);
     int32_t maxArgs_ = 0;
     int64_t vSchema_ = 0;
     std::weak_ptr<Connection> conn_;
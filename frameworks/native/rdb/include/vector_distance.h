@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_VECTOR_DISTANCE_H
+#define NATIVE_RDB_VECTOR_DISTANCE_H
+
+#include <cstddef>
+
+namespace OHOS {
+namespace NativeRdb {
+/**
+ * @brief The distance kernels of the float vectors, vectorized with NEON, SSE or AVX2 and a scalar fallback.
+ * The kernels are chosen once for the running CPU, the vectors may be unaligned.
+ */
+class VectorDistance {
+public:
+    static float L2Square(const float *lhs, const float *rhs, size_t size);
+    static float Dot(const float *lhs, const float *rhs, size_t size);
+    // Gets the dot, the squared norm of lhs and the squared norm of rhs in one pass.
+    static void Cosine(const float *lhs, const float *rhs, size_t size, float (&sums)[3]);
+};
+} // namespace NativeRdb
+} // namespace OHOS
+#endif // NATIVE_RDB_VECTOR_DISTANCE_H
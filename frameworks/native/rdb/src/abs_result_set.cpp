@@ -17,10 +17,12 @@
 #include "abs_result_set.h"
 
 #include <algorithm>
+#include <climits>
 #include <tuple>
 #include <utility>
 
 #include "logger.h"
+#include "raw_data_parser.h"
 #include "rdb_errno.h"
 #include "rdb_trace.h"
 #include "result_set.h"
@@ -100,6 +102,157 @@ void RowEntity::Clear(int32_t size)
     indexs_.resize(size);
 }
 
+bool ColumnBatch::Column::IsNull(int32_t row) const
+{
+    if (row < 0 || row >= rows_) {
+        return true;
+    }
+    return (nulls[row / CHAR_BIT] & (1 << (row % CHAR_BIT))) != 0;
+}
+
+void ColumnBatch::Column::Next(bool isNull)
+{
+    if (rows_ % CHAR_BIT == 0) {
+        nulls.push_back(0);
+    }
+    if (isNull) {
+        nulls[rows_ / CHAR_BIT] |= (1 << (rows_ % CHAR_BIT));
+    }
+    rows_++;
+}
+
+void ColumnBatch::Column::Promote(ColumnType target)
+{
+    if (target <= type) {
+        return;
+    }
+    if (target == ColumnType::TYPE_INTEGER) {
+        longs.assign(rows_, 0);
+    } else if (target == ColumnType::TYPE_FLOAT) {
+        if (type == ColumnType::TYPE_INTEGER) {
+            doubles.assign(longs.begin(), longs.end());
+        } else {
+            doubles.assign(rows_, 0);
+        }
+        longs.clear();
+    } else if (type != ColumnType::TYPE_STRING) {
+        // the numbers are converted to the text in the same way as ValueObject does.
+        offsets.assign(1, 0);
+        arena.clear();
+        for (int32_t row = 0; row < rows_; ++row) {
+            if (!IsNull(row)) {
+                auto text = type == ColumnType::TYPE_INTEGER ? static_cast<std::string>(ValueObject(longs[row]))
+                                                             : static_cast<std::string>(ValueObject(doubles[row]));
+                arena.insert(arena.end(), text.begin(), text.end());
+            }
+            offsets.push_back(arena.size());
+        }
+        longs.clear();
+        doubles.clear();
+    }
+    type = target;
+}
+
+void ColumnBatch::Column::PutNull()
+{
+    if (type == ColumnType::TYPE_INTEGER) {
+        longs.push_back(0);
+    } else if (type == ColumnType::TYPE_FLOAT) {
+        doubles.push_back(0);
+    } else if (type != ColumnType::TYPE_NULL) {
+        offsets.push_back(arena.size());
+    }
+    Next(true);
+}
+
+void ColumnBatch::Column::PutLong(int64_t value)
+{
+    Promote(ColumnType::TYPE_INTEGER);
+    if (type == ColumnType::TYPE_INTEGER) {
+        longs.push_back(value);
+        Next(false);
+        return;
+    }
+    if (type == ColumnType::TYPE_FLOAT) {
+        doubles.push_back(static_cast<double>(value));
+        Next(false);
+        return;
+    }
+    auto text = static_cast<std::string>(ValueObject(value));
+    PutText(type, text.data(), text.size());
+}
+
+void ColumnBatch::Column::PutDouble(double value)
+{
+    Promote(ColumnType::TYPE_FLOAT);
+    if (type == ColumnType::TYPE_FLOAT) {
+        doubles.push_back(value);
+        Next(false);
+        return;
+    }
+    auto text = static_cast<std::string>(ValueObject(value));
+    PutText(type, text.data(), text.size());
+}
+
+void ColumnBatch::Column::PutText(ColumnType textType, const void *data, size_t size)
+{
+    Promote(textType == ColumnType::TYPE_BLOB ? ColumnType::TYPE_BLOB : ColumnType::TYPE_STRING);
+    if (data != nullptr && size > 0) {
+        auto begin = static_cast<const uint8_t *>(data);
+        arena.insert(arena.end(), begin, begin + size);
+    }
+    offsets.push_back(arena.size());
+    Next(false);
+}
+
+void ColumnBatch::Column::PutRawData(const std::vector<uint8_t> &rawData)
+{
+    PutText(ColumnType::TYPE_BLOB, rawData.data(), rawData.size());
+}
+
+int ColumnBatch::Column::PutValue(const ValueObject &value)
+{
+    switch (value.GetType()) {
+        case ValueObject::TYPE_NULL:
+            PutNull();
+            break;
+        case ValueObject::TYPE_INT:
+            PutLong(std::get<int64_t>(value.value));
+            break;
+        case ValueObject::TYPE_BOOL:
+            PutLong(std::get<bool>(value.value) ? 1 : 0);
+            break;
+        case ValueObject::TYPE_DOUBLE:
+            PutDouble(std::get<double>(value.value));
+            break;
+        case ValueObject::TYPE_STRING: {
+            auto &text = std::get<std::string>(value.value);
+            PutText(ColumnType::TYPE_STRING, text.data(), text.size());
+            break;
+        }
+        case ValueObject::TYPE_BLOB: {
+            auto &blob = std::get<ValueObject::Blob>(value.value);
+            PutText(ColumnType::TYPE_BLOB, blob.data(), blob.size());
+            break;
+        }
+        case ValueObject::TYPE_ASSET:
+            PutRawData(RawDataParser::PackageRawData(std::get<ValueObject::Asset>(value.value)));
+            break;
+        case ValueObject::TYPE_ASSETS:
+            PutRawData(RawDataParser::PackageRawData(std::get<ValueObject::Assets>(value.value)));
+            break;
+        case ValueObject::TYPE_VECS:
+            PutRawData(RawDataParser::PackageRawData(std::get<ValueObject::FloatVector>(value.value)));
+            break;
+        case ValueObject::TYPE_BIGINT:
+            PutRawData(RawDataParser::PackageRawData(std::get<ValueObject::BigInt>(value.value)));
+            break;
+        default:
+            return E_INVALID_OBJECT_TYPE;
+    }
+    return E_OK;
+}
+
 AbsResultSet::AbsResultSet()
 {
 }
@@ -403,6 +556,82 @@ std::pair<int, std::vector<std::vector<ValueObject>>> AbsResultSet::GetRowsData(
     return { E_OK, std::move(rowsData) };
 }
 
+std::pair<int, ColumnBatch> AbsResultSet::FetchColumns(int32_t maxCount)
+{
+    DISTRIBUTED_DATA_HITRACE(std::string(__FUNCTION__));
+    if (lastErr_ != E_OK) {
+        LOG_ERROR("ResultSet has lastErr %{public}d", lastErr_);
+        return { lastErr_, {} };
+    }
+
+    if (maxCount < 0) {
+        LOG_ERROR("Invalid parameter! maxCount:%{public}d", maxCount);
+        return { E_INVALID_ARGS, {} };
+    }
+
+    auto errCode = InitColumnNames();
+    if (errCode != E_OK) {
+        LOG_ERROR("ret is %{public}d", errCode);
+        return { errCode, {} };
+    }
+
+    ColumnBatch batch;
+    batch.columns.resize(columnCount_);
+    if (maxCount == 0) {
+        return { E_OK, std::move(batch) };
+    }
+
+    int rowPos = 0;
+    GetRowIndex(rowPos);
+    if (rowPos == INIT_POS) {
+        errCode = GoToFirstRow();
+        if (errCode == E_ROW_OUT_RANGE) {
+            return { E_OK, std::move(batch) };
+        }
+        if (errCode != E_OK) {
+            LOG_ERROR("Fail code:%{public}d. [%{public}d, %{public}d]", errCode, maxCount, rowPos_);
+            return { errCode, {} };
+        }
+    }
+
+    for (int32_t i = 0; i < maxCount; ++i) {
+        errCode = FetchRow(batch);
+        if (errCode == E_ROW_OUT_RANGE) {
+            break;
+        }
+        if (errCode != E_OK) {
+            return { errCode, {} };
+        }
+        batch.rowCount++;
+        errCode = GoToNextRow();
+        if (errCode == E_ROW_OUT_RANGE) {
+            break;
+        }
+        if (errCode != E_OK) {
+            LOG_ERROR("code:%{public}d. [%{public}d, %{public}d]", errCode, maxCount, rowPos_);
+            return { errCode, {} };
+        }
+    }
+    return { E_OK, std::move(batch) };
+}
+
+int AbsResultSet::FetchRow(ColumnBatch &batch)
+{
+    for (size_t col = 0; col < batch.columns.size(); ++col) {
+        ValueObject value;
+        auto errCode = Get(static_cast<int32_t>(col), value);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        errCode = batch.columns[col].PutValue(value);
+        if (errCode != E_OK) {
+            LOG_ERROR("col:%{public}zu, type:%{public}d", col, value.GetType());
+            return errCode;
+        }
+    }
+    return E_OK;
+}
+
 int AbsResultSet::GoToRow(int position)
 {
     return E_OK;
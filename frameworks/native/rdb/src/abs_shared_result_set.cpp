@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <codecvt>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -28,6 +29,7 @@
 #include "rdb_errno.h"
 #include "rdb_trace.h"
 #include "shared_block.h"
+#include "shared_block_pool.h"
 
 namespace OHOS {
 namespace NativeRdb {
@@ -67,13 +69,12 @@ std::shared_ptr<SharedBlock> AbsSharedResultSet::GetBlock()
     if (sharedBlock_ != nullptr || isClosed_ || lowMem_) {
         return sharedBlock_;
     }
-    SharedBlock *block = nullptr;
-    auto errcode = SharedBlock::Create(sharedBlockName_, DEFAULT_BLOCK_SIZE, block);
+    auto [errcode, block] = SharedBlockPool::GetInstance().Acquire(sharedBlockName_, DEFAULT_BLOCK_SIZE);
     if (errcode != SharedBlock::SHARED_BLOCK_OK) {
         lowMem_ = true;
         return nullptr;
     }
-    sharedBlock_ = std::shared_ptr<SharedBlock>(block);
+    sharedBlock_ = std::move(block);
     return sharedBlock_;
 }
 
@@ -95,9 +96,10 @@ int AbsSharedResultSet::GetColumnType(int columnIndex, ColumnType &columnType)
 
 int AbsSharedResultSet::UpdateBlockPos(int position, int rowCnt)
 {
-    auto block = GetBlock();
     auto ret = OnGo(rowPos_, position);
-    if (ret == E_OK) {
+    // OnGo may have put another block in place.
+    auto block = GetBlock();
+    if (ret == E_OK && block != nullptr) {
         uint32_t startPos = block->GetStartPos();
         uint32_t blockPos = block->GetBlockPos();
         if (static_cast<uint32_t>(position) != startPos + blockPos) {
@@ -177,6 +179,54 @@ int AbsSharedResultSet::Get(int32_t col, ValueObject &value)
     return E_OK;
 }
 
+int AbsSharedResultSet::FetchRow(ColumnBatch &batch)
+{
+    auto block = GetBlock();
+    int errorCode = CheckState(0);
+    if (errorCode != E_OK || block == nullptr) {
+        return errorCode;
+    }
+
+    auto row = block->GetBlockPos();
+    for (uint32_t col = 0; col < batch.columns.size(); ++col) {
+        auto *cellUnit = block->GetCellUnit(row, col);
+        if (cellUnit == nullptr) {
+            LOG_ERROR("cellUnit is null, col is %{public}u!", col);
+            return E_ERROR;
+        }
+        auto &column = batch.columns[col];
+        switch (cellUnit->type) {
+            case SharedBlock::CELL_UNIT_TYPE_NULL:
+                column.PutNull();
+                break;
+            case SharedBlock::CELL_UNIT_TYPE_INTEGER:
+                column.PutLong(cellUnit->cell.longValue);
+                break;
+            case SharedBlock::CELL_UNIT_TYPE_FLOAT:
+                column.PutDouble(cellUnit->cell.doubleValue);
+                break;
+            case SharedBlock::CELL_UNIT_TYPE_STRING: {
+                // the size of the string in the block includes the terminating null.
+                size_t size = cellUnit->cell.stringOrBlobValue.size;
+                auto data = reinterpret_cast<const char *>(cellUnit->GetRawData(block.get()));
+                size = (data == nullptr || size < 1) ? 0 : strnlen(data, size - 1);
+                column.PutText(ColumnType::TYPE_STRING, data, size);
+                break;
+            }
+            case SharedBlock::CELL_UNIT_TYPE_BLOB: {
+                auto data = cellUnit->GetRawData(block.get());
+                size_t size = data == nullptr ? 0 : cellUnit->cell.stringOrBlobValue.size;
+                column.PutText(ColumnType::TYPE_BLOB, data, size);
+                break;
+            }
+            default:
+                LOG_ERROR("Invalid type is %{public}d, col is %{public}u!", cellUnit->type, col);
+                return E_INVALID_OBJECT_TYPE;
+        }
+    }
+    return E_OK;
+}
+
 int AbsSharedResultSet::GetSize(int columnIndex, size_t &size)
 {
     size = 0;
@@ -241,6 +291,25 @@ void AbsSharedResultSet::ClosedBlock()
     sharedBlock_ = nullptr;
 }
 
+/**
+ * Puts the filled block in place of the current one and returns the block which is free to fill. The block whose
+ * shared memory has been handed out keeps its place, the rows are copied into it instead.
+ */
+std::shared_ptr<SharedBlock> AbsSharedResultSet::ExchangeBlock(std::shared_ptr<SharedBlock> block)
+{
+    std::lock_guard<decltype(globalMtx_)> lockGuard(globalMtx_);
+    if (block == nullptr || sharedBlock_ == nullptr || !sharedBlock_->IsShared()) {
+        sharedBlock_.swap(block);
+        return block;
+    }
+    auto errCode = sharedBlock_->SetRawData(block->GetHeader(), block->GetUsedBytes());
+    if (errCode != SharedBlock::SHARED_BLOCK_OK) {
+        LOG_ERROR("copy block failed, errCode:%{public}zu, used:%{public}zu", errCode, block->GetUsedBytes());
+        sharedBlock_->Clear();
+    }
+    return block;
+}
+
 void AbsSharedResultSet::ClearBlock()
 {
     auto block = GetBlock();
@@ -304,15 +373,21 @@ int AbsSharedResultSet::CheckState(int columnIndex)
     if (isClosed_) {
         return E_ALREADY_CLOSED;
     }
-    if (GetBlock() == nullptr) {
+    auto block = GetBlock();
+    if (block == nullptr) {
         LOG_ERROR("SharedBlock is null!");
         return E_ERROR;
     }
     int count = 0;
-    GetRowCount(count);
-    if (rowPos_ < 0 || rowPos_ >= count) {
-        SetLastErrorMsg(BuildRowRangeCtx());
-        return E_ROW_OUT_RANGE;
+    // The row held by the current block exists, the row count is not required for it.
+    bool inBlock = rowPos_ >= 0 && static_cast<uint32_t>(rowPos_) >= block->GetStartPos() &&
+                   static_cast<uint32_t>(rowPos_) < block->GetLastPos();
+    if (!inBlock) {
+        GetRowCount(count);
+        if (rowPos_ < 0 || rowPos_ >= count) {
+            SetLastErrorMsg(BuildRowRangeCtx());
+            return E_ROW_OUT_RANGE;
+        }
     }
 
     GetColumnCount(count);
@@ -29,15 +29,51 @@ CacheResultSet::CacheResultSet() : row_(0), maxRow_(0), maxCol_(0)
 {
 }
 CacheResultSet::CacheResultSet(std::vector<NativeRdb::ValuesBucket> &&valueBuckets, int initPos)
-    : row_(initPos), maxCol_(0), valueBuckets_(std::move(valueBuckets))
-{
-    maxRow_ = static_cast<int>(valueBuckets_.size());
-    if (maxRow_ > 0) {
-        for (auto it = valueBuckets_[0].values_.begin(); it != valueBuckets_[0].values_.end(); it++) {
-            colNames_.push_back(it->first);
-            colTypes_.push_back(it->second.GetType());
+    : row_(initPos), maxCol_(0)
+{
+    maxRow_ = static_cast<int>(valueBuckets.size());
+    if (maxRow_ <= 0) {
+        return;
+    }
+    for (auto it = valueBuckets[0].values_.begin(); it != valueBuckets[0].values_.end(); it++) {
+        colNames_.push_back(it->first);
+        colTypes_.push_back(it->second.GetType());
+    }
+    maxCol_ = static_cast<int>(colNames_.size());
+    values_.resize(static_cast<size_t>(maxRow_) * maxCol_);
+    for (int32_t row = 0; row < maxRow_; row++) {
+        // the columns of each bucket are sorted by name as colNames_, so they are matched in one walk.
+        auto &values = valueBuckets[row].values_;
+        auto it = values.begin();
+        for (int32_t col = 0; col < maxCol_; col++) {
+            while (it != values.end() && it->first < colNames_[col]) {
+                ++it;
+            }
+            if (it == values.end() || it->first != colNames_[col]) {
+                incompleteRows_.resize(maxRow_, false);
+                incompleteRows_[row] = true;
+                continue;
+            }
+            values_[row * maxCol_ + col] = std::move(it->second);
         }
-        maxCol_ = static_cast<int>(colNames_.size());
+    }
+    valueBuckets.clear();
+}
+
+CacheResultSet::CacheResultSet(std::vector<std::string> &&colNames, std::vector<ValueObject> &&values, int initPos)
+    : row_(initPos), maxRow_(0), maxCol_(0)
+{
+    if (colNames.empty() || values.size() < colNames.size()) {
+        return;
+    }
+    maxCol_ = static_cast<int>(colNames.size());
+    maxRow_ = static_cast<int>(values.size() / colNames.size());
+    colNames_ = std::move(colNames);
+    values_ = std::move(values);
+    values_.resize(static_cast<size_t>(maxRow_) * maxCol_);
+    colTypes_.reserve(maxCol_);
+    for (int32_t col = 0; col < maxCol_; col++) {
+        colTypes_.push_back(values_[col].GetType());
     }
 }
 
@@ -71,12 +107,11 @@ int CacheResultSet::GetBlob(int columnIndex, std::vector<uint8_t> &blob)
     if (columnIndex < 0 || columnIndex >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[columnIndex];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetBlob(blob);
+    return values_[row_ * maxCol_ + columnIndex].GetBlob(blob);
 }
 
 int CacheResultSet::GetString(int columnIndex, std::string &value)
@@ -87,12 +122,11 @@ int CacheResultSet::GetString(int columnIndex, std::string &value)
     if (columnIndex < 0 || columnIndex >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[columnIndex];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetString(value);
+    return values_[row_ * maxCol_ + columnIndex].GetString(value);
 }
 
 int CacheResultSet::GetInt(int columnIndex, int &value)
@@ -103,12 +137,11 @@ int CacheResultSet::GetInt(int columnIndex, int &value)
     if (columnIndex < 0 || columnIndex >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[columnIndex];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetInt(value);
+    return values_[row_ * maxCol_ + columnIndex].GetInt(value);
 }
 
 int CacheResultSet::GetLong(int columnIndex, int64_t &value)
@@ -119,12 +152,11 @@ int CacheResultSet::GetLong(int columnIndex, int64_t &value)
     if (columnIndex < 0 || columnIndex >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[columnIndex];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetLong(value);
+    return values_[row_ * maxCol_ + columnIndex].GetLong(value);
 }
 
 int CacheResultSet::GetDouble(int columnIndex, double &value)
@@ -135,12 +167,11 @@ int CacheResultSet::GetDouble(int columnIndex, double &value)
     if (columnIndex < 0 || columnIndex >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[columnIndex];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetDouble(value);
+    return values_[row_ * maxCol_ + columnIndex].GetDouble(value);
 }
 
 int CacheResultSet::IsColumnNull(int columnIndex, bool &isNull)
@@ -151,12 +182,11 @@ int CacheResultSet::IsColumnNull(int columnIndex, bool &isNull)
     if (columnIndex < 0 || columnIndex >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[columnIndex];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    isNull = valueBuckets_[row_].values_[name].GetType() == ValueObject::TYPE_NULL;
+    isNull = values_[row_ * maxCol_ + columnIndex].GetType() == ValueObject::TYPE_NULL;
     return E_OK;
 }
 
@@ -169,19 +199,47 @@ int CacheResultSet::GetRow(RowEntity &rowEntity)
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
+    if (IsIncomplete(row_)) {
+        return E_ERROR;
+    }
     rowEntity.Clear(colNames_.size());
-    int32_t index = 0;
-    for (auto &columnName : colNames_) {
-        ValueObject object;
-        if (!valueBuckets_[row_].GetObject(columnName, object)) {
-            return E_ERROR;
-        }
-        rowEntity.Put(columnName, index, std::move(object));
-        index++;
+    auto *values = &values_[row_ * maxCol_];
+    for (int32_t index = 0; index < maxCol_; index++) {
+        rowEntity.Put(colNames_[index], index, ValueObject(values[index]));
     }
     return E_OK;
 }
 
+std::pair<int, ColumnBatch> CacheResultSet::FetchColumns(int32_t maxCount)
+{
+    if (isClosed_) {
+        return { E_ALREADY_CLOSED, {} };
+    }
+    if (maxCount < 0) {
+        return { E_INVALID_ARGS, {} };
+    }
+    std::unique_lock<decltype(rwMutex_)> lock(rwMutex_);
+    ColumnBatch batch;
+    batch.columns.resize(colNames_.size());
+    if (maxCount > 0 && row_ < 0) {
+        row_ = 0;
+    }
+    for (; batch.rowCount < maxCount && row_ < maxRow_; ++row_) {
+        if (IsIncomplete(row_)) {
+            return { E_ERROR, {} };
+        }
+        auto *values = &values_[row_ * maxCol_];
+        for (int32_t col = 0; col < maxCol_; ++col) {
+            auto errCode = batch.columns[col].PutValue(values[col]);
+            if (errCode != E_OK) {
+                return { errCode, {} };
+            }
+        }
+        batch.rowCount++;
+    }
+    return { E_OK, std::move(batch) };
+}
+
 int CacheResultSet::GoToRow(int position)
 {
     if (isClosed_) {
@@ -341,7 +399,8 @@ int CacheResultSet::Close()
     if (!isClosed_) {
         auto colNames = std::move(colNames_);
         auto colTypes = std::move(colTypes_);
-        auto valueBuckets = std::move(valueBuckets_);
+        auto values = std::move(values_);
+        auto incompleteRows = std::move(incompleteRows_);
         row_ = -1;
         maxRow_ = -1;
         maxCol_ = -1;
@@ -358,12 +417,11 @@ int CacheResultSet::GetAsset(int32_t col, ValueObject::Asset &value)
     if (col < 0 || col >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[col];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetAsset(value);
+    return values_[row_ * maxCol_ + col].GetAsset(value);
 }
 
 int CacheResultSet::GetAssets(int32_t col, ValueObject::Assets &value)
@@ -374,12 +432,11 @@ int CacheResultSet::GetAssets(int32_t col, ValueObject::Assets &value)
     if (col < 0 || col >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[col];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetAssets(value);
+    return values_[row_ * maxCol_ + col].GetAssets(value);
 }
 
 int CacheResultSet::GetFloat32Array(int32_t index, ValueObject::FloatVector &vecs)
@@ -390,12 +447,11 @@ int CacheResultSet::GetFloat32Array(int32_t index, ValueObject::FloatVector &vec
     if (index < 0 || index >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[index];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    return valueBuckets_[row_].values_[name].GetVecs(vecs);
+    return values_[row_ * maxCol_ + index].GetVecs(vecs);
 }
 
 int CacheResultSet::Get(int32_t col, ValueObject &value)
@@ -406,15 +462,19 @@ int CacheResultSet::Get(int32_t col, ValueObject &value)
     if (col < 0 || col >= maxCol_) {
         return E_COLUMN_OUT_RANGE;
     }
-    auto name = colNames_[col];
     std::shared_lock<decltype(rwMutex_)> lock(rwMutex_);
     if (row_ < 0 || row_ >= maxRow_) {
         return E_ROW_OUT_RANGE;
     }
-    value = valueBuckets_[row_].values_[name];
+    value = values_[row_ * maxCol_ + col];
     return E_OK;
 }
 
+bool CacheResultSet::IsIncomplete(int32_t row) const
+{
+    return !incompleteRows_.empty() && incompleteRows_[row];
+}
+
 int CacheResultSet::GetSize(int columnIndex, size_t &size)
 {
     if (isClosed_) {
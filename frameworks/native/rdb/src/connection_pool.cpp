@@ -18,9 +18,11 @@
 
 #include <base_transaction.h>
 
+#include <algorithm>
 #include <condition_variable>
 #include <iterator>
 #include <mutex>
+#include <new>
 #include <sstream>
 #include <vector>
 
@@ -31,6 +33,7 @@
 #include "rdb_fault_hiview_reporter.h"
 #include "rdb_perfStat.h"
 #include "rdb_sql_statistic.h"
+#include "slave_replicator.h"
 #include "sqlite_global_config.h"
 #include "sqlite_utils.h"
 #include "task_executor.h"
@@ -125,6 +128,9 @@ ConnPool::ConnectionPool(std::shared_ptr<RdbStoreConfig> configHolder, const Rdb
     trans_.left_ = trans_.right_;
     clearActuator_ = std::make_shared<DelayActuator>(FIRST_DELAY_INTERVAL, MIN_EXECUTE_INTERVAL, MAX_EXECUTE_INTERVAL);
     clearActuator_->SetExecutorPool(TaskExecutor::GetInstance().GetExecutor());
+    if (storeConfig.IsAsyncReplication() && storeConfig.GetHaMode() != HAMode::SINGLE) {
+        replicator_ = std::make_shared<SlaveReplicator>(storeConfig.GetPath());
+    }
 }
 
 std::pair<int32_t, std::shared_ptr<Connection>> ConnPool::Init(bool isAttach, bool needWriter)
@@ -141,8 +147,7 @@ std::pair<int32_t, std::shared_ptr<Connection>> ConnPool::Init(bool isAttach, bo
         // write connect count is 1
         std::shared_ptr<ConnPool::ConnNode> node;
         auto create = [this, isAttach]() {
-            const RdbStoreConfig &config = isAttach ? attachConfig_ : config_;
-            return Connection::Create(config, true);
+            return CreateWriter(isAttach);
         };
         std::tie(errCode, node) = writers_.Initialize(create, 1, config.GetWriteTime(), true, needWriter);
         conn = Convert2AutoConn(node);
@@ -173,6 +178,17 @@ std::pair<int32_t, std::shared_ptr<Connection>> ConnPool::Init(bool isAttach, bo
     return result;
 }
 
+std::pair<int32_t, std::shared_ptr<Connection>> ConnPool::CreateWriter(bool isAttach)
+{
+    const RdbStoreConfig &config = isAttach ? attachConfig_ : config_;
+    auto result = Connection::Create(config, true);
+    auto &[errCode, conn] = result;
+    if (errCode == E_OK && conn != nullptr && replicator_ != nullptr) {
+        conn->SetReplicator(replicator_);
+    }
+    return result;
+}
+
 ConnPool::~ConnectionPool()
 {
     clearActuator_ = nullptr;
@@ -443,6 +459,7 @@ void ConnPool::ReleaseNode(std::shared_ptr<ConnNode> node, bool isTrans)
     if (node->IsWriter() && (errCode != E_INNER_WARNING && errCode != E_NOT_SUPPORT)) {
         failedTime_ = errCode != E_OK ? now : steady_clock::time_point();
     }
+    bool isDeferred = node->IsWriter() && errCode == E_INNER_WARNING && timeout && remainCount <= 0;
 
     if (isTrans) {
         trans_.ReleaseTrans(node);
@@ -453,6 +470,47 @@ void ConnPool::ReleaseNode(std::shared_ptr<ConnNode> node, bool isTrans)
             clearActuator_->Execute();
         }
     }
+    if (isDeferred) {
+        ScheduleCheckPoint();
+    }
+}
+
+void ConnPool::ScheduleCheckPoint()
+{
+    if (isCheckPointing_.exchange(true)) {
+        return;
+    }
+    auto executor = TaskExecutor::GetInstance().GetExecutor();
+    if (executor == nullptr) {
+        isCheckPointing_ = false;
+        return;
+    }
+    executor->Execute([pool = weak_from_this()]() {
+        auto realPool = pool.lock();
+        if (realPool == nullptr) {
+            return;
+        }
+        realPool->IdleCheckPoint();
+        realPool->isCheckPointing_ = false;
+    });
+}
+
+void ConnPool::IdleCheckPoint()
+{
+    if (transCount_ + isInTransaction_ > 0) {
+        return;
+    }
+    auto [errCode, node] = writers_.Acquire(IDLE_ACQUIRE_TIME);
+    if (node == nullptr) {
+        return;
+    }
+    if (node->connect_ != nullptr) {
+        errCode = node->connect_->IdleCheckPoint();
+        if (errCode != E_NOT_SUPPORT) {
+            failedTime_ = errCode != E_OK ? steady_clock::now() : steady_clock::time_point();
+        }
+    }
+    writers_.Release(node);
 }
 
 int ConnPool::AcquireTransaction()
@@ -490,8 +548,7 @@ int ConnPool::RestartConns()
     trans_.Clear();
     trans_.InitMembers(
         [this]() {
-            const RdbStoreConfig &config = isAttach_ ? attachConfig_ : config_;
-            return Connection::Create(config, true);
+            return CreateWriter(isAttach_);
         },
         MAX_TRANS, config.GetTransactionTime(), false);
     return errCode;
@@ -738,6 +795,13 @@ bool ConnPool::ConnNode::IsWriter() const
     return false;
 }
 
+ConnPool::Container::~Container()
+{
+    for (auto &slot : slots_) {
+        delete slot.exchange(nullptr);
+    }
+}
+
 void ConnPool::Container::InitMembers(Creator creator, int32_t max, int32_t timeout, bool disable)
 {
     {
@@ -789,6 +853,8 @@ std::pair<int32_t, std::shared_ptr<ConnPool::ConnNode>> ConnPool::Container::Ini
             nodes_.pop_back();
             count_--;
         }
+        minId_ = left_;
+        slotNum_ = std::min(max_, MAX_SLOTS);
     }
     cond_.notify_all();
     return { E_OK, connNode };
@@ -834,6 +900,10 @@ int32_t ConnPool::Container::SetTokenizer(Tokenizer tokenizer)
 
 std::pair<int, std::shared_ptr<ConnPool::ConnNode>> ConnPool::Container::Acquire(std::chrono::milliseconds milliS)
 {
+    auto slotNode = AcquireSlot();
+    if (slotNode != nullptr) {
+        return {E_OK, slotNode};
+    }
     std::unique_lock<decltype(mutex_)> lock(mutex_);
     auto interval = (milliS == INVALID_TIME) ? timeout_ : milliS;
     if (max_ == 0) {
@@ -841,6 +911,7 @@ std::pair<int, std::shared_ptr<ConnPool::ConnNode>> ConnPool::Container::Acquire
     }
     int errCode = E_OK;
     auto waiter = [this, &errCode]() -> bool {
+        ReclaimSlots();
         if (count_ > 0) {
             return true;
         }
@@ -851,10 +922,13 @@ std::pair<int, std::shared_ptr<ConnPool::ConnNode>> ConnPool::Container::Acquire
         errCode = ExtendNode();
         return errCode == E_OK;
     };
-    if (cond_.wait_for(lock, interval, waiter)) {
+    waiters_++;
+    auto isReady = cond_.wait_for(lock, interval, waiter);
+    waiters_--;
+    if (isReady) {
         if (nodes_.empty()) {
             LOG_ERROR("Nodes is empty.count %{public}d max %{public}d total %{public}d left %{public}d right%{public}d",
-                count_, max_, total_, left_, right_);
+                count_.load(), max_, total_, left_, right_);
             count_ = 0;
             return {E_ERROR, nullptr};
         }
@@ -893,7 +967,12 @@ std::pair<bool, std::list<std::shared_ptr<ConnPool::ConnNode>>> ConnPool::Contai
     auto interval = (milliS == INVALID_TIME) ? timeout_ : milliS;
     auto time = std::chrono::steady_clock::now() + interval;
     std::unique_lock<decltype(mutex_)> lock(mutex_);
-    while (count < total_ && cond_.wait_until(lock, time, [this]() { return count_ > 0; })) {
+    waiters_++;
+    auto waiter = [this]() -> bool {
+        ReclaimSlots();
+        return count_ > 0;
+    };
+    while (count < total_ && cond_.wait_until(lock, time, waiter)) {
         nodes.merge(std::move(nodes_));
         nodes_.clear();
         count += count_;
@@ -901,6 +980,7 @@ std::pair<bool, std::list<std::shared_ptr<ConnPool::ConnNode>>> ConnPool::Contai
     }
 
     if (count != total_) {
+        waiters_--;
         count_ = count;
         nodes_ = std::move(nodes);
         nodes.clear();
@@ -920,6 +1000,7 @@ std::pair<bool, std::list<std::shared_ptr<ConnPool::ConnNode>>> ConnPool::Contai
     bool failed = false;
     while (failed = !func(nodes), failed && cond_.wait_until(lock, time) != std::cv_status::timeout) {
     }
+    waiters_--;
     if (failed) {
         count_ = count;
         nodes_ = std::move(nodes);
@@ -931,6 +1012,7 @@ std::pair<bool, std::list<std::shared_ptr<ConnPool::ConnNode>>> ConnPool::Contai
 std::shared_ptr<ConnPool::ConnNode> ConnPool::Container::AcquireById(int32_t id)
 {
     std::unique_lock<decltype(mutex_)> lock(mutex_);
+    ReclaimSlots();
     if (count_ == 0) {
         return nullptr;
     }
@@ -968,13 +1050,16 @@ void ConnPool::Container::Enable()
 
 int32_t ConnPool::Container::Release(std::shared_ptr<ConnNode> node)
 {
+    if (ReleaseSlot(node)) {
+        return E_OK;
+    }
     {
         std::unique_lock<decltype(mutex_)> lock(mutex_);
         if (node->id_ < left_ || node->id_ >= right_) {
             return E_OK;
         }
-        if (count_ == max_) {
-            total_ = total_ > count_ ? total_ - 1 : count_;
+        if (count_ + slotted_ >= max_) {
+            total_ = total_ > count_ ? total_ - 1 : count_.load();
             RelDetails(node);
         } else {
             nodes_.push_front(node);
@@ -1004,6 +1089,85 @@ int32_t ConnectionPool::Container::ReleaseTrans(std::shared_ptr<ConnNode> node)
     return E_OK;
 }
 
+std::shared_ptr<ConnPool::ConnNode> ConnPool::Container::AcquireSlot()
+{
+    int32_t num = slotNum_;
+    if (num <= 0 || slotted_ <= 0) {
+        return nullptr;
+    }
+    // start from the slot of the thread, it holds the node this thread used last time.
+    uint32_t home = static_cast<uint32_t>(gettid()) % static_cast<uint32_t>(num);
+    for (int32_t i = 0; i < num; ++i) {
+        auto &slot = slots_[(home + i) % num];
+        auto holder = slot.load() == nullptr ? nullptr : slot.exchange(nullptr);
+        if (holder == nullptr) {
+            continue;
+        }
+        slotted_--;
+        std::shared_ptr<ConnNode> node = std::move(*holder);
+        delete holder;
+        // the node released while clearing belongs to the closed connections.
+        if (node->id_ < minId_) {
+            continue;
+        }
+        return node;
+    }
+    return nullptr;
+}
+
+bool ConnPool::Container::ReleaseSlot(std::shared_ptr<ConnNode> &node)
+{
+    int32_t num = slotNum_;
+    if (num <= 0 || node->id_ < minId_) {
+        return false;
+    }
+    // the extended node over the max count is freed by the locked path.
+    if (count_ + slotted_.fetch_add(1) >= num) {
+        slotted_--;
+        return false;
+    }
+    auto holder = new (std::nothrow) std::shared_ptr<ConnNode>(node);
+    if (holder == nullptr) {
+        slotted_--;
+        return false;
+    }
+    uint32_t home = static_cast<uint32_t>(gettid()) % static_cast<uint32_t>(num);
+    for (int32_t i = 0; i < num; ++i) {
+        std::shared_ptr<ConnNode> *expected = nullptr;
+        if (!slots_[(home + i) % num].compare_exchange_strong(expected, holder)) {
+            continue;
+        }
+        if (waiters_ > 0) {
+            // the waiter checks the slots with the lock held, taking it makes sure the waiter is sleeping.
+            { std::unique_lock<decltype(mutex_)> lock(mutex_); }
+            cond_.notify_one();
+        }
+        return true;
+    }
+    delete holder;
+    slotted_--;
+    return false;
+}
+
+void ConnPool::Container::ReclaimSlots()
+{
+    if (slotted_ <= 0) {
+        return;
+    }
+    for (auto &slot : slots_) {
+        auto holder = slot.exchange(nullptr);
+        if (holder == nullptr) {
+            continue;
+        }
+        slotted_--;
+        if ((*holder)->id_ >= left_ && (*holder)->id_ < right_) {
+            nodes_.push_front(std::move(*holder));
+            count_++;
+        }
+        delete holder;
+    }
+}
+
 int32_t ConnectionPool::Container::RelDetails(std::shared_ptr<ConnNode> node)
 {
     for (auto it = details_.begin(); it != details_.end();) {
@@ -1042,6 +1206,7 @@ int32_t ConnPool::Container::Clear()
     std::list<std::weak_ptr<ConnNode>> details;
     {
         std::unique_lock<decltype(mutex_)> lock(mutex_);
+        ReclaimSlots();
         nodes = std::move(nodes_);
         details = std::move(details_);
         disable_ = true;
@@ -1051,6 +1216,8 @@ int32_t ConnPool::Container::Clear()
             right_ = 0;
         }
         left_ = right_;
+        minId_ = left_;
+        slotNum_ = 0;
         creator_ = nullptr;
     }
     nodes.clear();
@@ -1061,6 +1228,7 @@ int32_t ConnPool::Container::Clear()
 bool ConnPool::Container::IsFull()
 {
     std::unique_lock<decltype(mutex_)> lock(mutex_);
+    ReclaimSlots();
     return total_ == count_;
 }
 
@@ -1076,7 +1244,7 @@ int32_t ConnPool::Container::Dump(const char *header, int32_t count)
     std::string allInfo;
     std::vector<std::shared_ptr<ConnNode>> details;
     std::string title = "B_M_T_C[" + std::to_string(count) + "," + std::to_string(max_) + "," +
-                        std::to_string(total_) + "," + std::to_string(count_) + "]";
+                        std::to_string(total_) + "," + std::to_string(count_ + slotted_) + "]";
     {
         std::unique_lock<decltype(mutex_)> lock(mutex_);
         details.reserve(details_.size());
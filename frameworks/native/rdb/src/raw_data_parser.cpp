@@ -15,34 +15,122 @@
 
 #include "raw_data_parser.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 
 #include "multi_platform_endian.h"
 
 namespace OHOS::NativeRdb {
-size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, Asset &asset)
+namespace {
+template<typename T>
+bool ReadLe(const uint8_t *data, size_t length, size_t &used, T &value)
+{
+    if (sizeof(T) > length - used) {
+        return false;
+    }
+    std::memcpy(&value, data + used, sizeof(T));
+    value = Endian::LeToH(value);
+    used += sizeof(T);
+    return true;
+}
+
+bool ReadString(const uint8_t *data, size_t length, size_t &used, std::string &value)
+{
+    uint32_t size = 0;
+    if (!ReadLe(data, length, used, size) || size > length - used) {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char *>(data + used), size);
+    used += size;
+    return true;
+}
+
+template<typename T>
+void WriteLe(std::vector<uint8_t> &rawData, T value)
+{
+    value = Endian::HToLe(value);
+    auto bytes = reinterpret_cast<const uint8_t *>(&value);
+    rawData.insert(rawData.end(), bytes, bytes + sizeof(T));
+}
+
+void WriteString(std::vector<uint8_t> &rawData, const std::string &value)
+{
+    WriteLe(rawData, static_cast<uint32_t>(value.size()));
+    rawData.insert(rawData.end(), value.begin(), value.end());
+}
+
+uint32_t PeekMagic(const uint8_t *data, size_t length)
 {
     size_t used = 0;
-    uint16_t size = 0;
+    uint32_t magic = 0;
+    ReadLe(data, length, used, magic);
+    return magic;
+}
+} // namespace
 
-    if (sizeof(ASSET_MAGIC) > length - used) {
-        return 0;
+#ifdef RDB_BINARY_ASSET
+std::atomic<int32_t> RawDataParser::assetFormat_(ASSET_FORMAT_BINARY);
+#else
+std::atomic<int32_t> RawDataParser::assetFormat_(ASSET_FORMAT_JSON);
+#endif
+
+size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, Asset &asset)
+{
+    auto magic = PeekMagic(data, length);
+    if (magic == ASSET_BIN_MAGIC) {
+        return ParserBinaryAsset(data, length, asset);
     }
-    std::vector<uint8_t> alignData;
-    alignData.assign(data, data + sizeof(ASSET_MAGIC));
-    used += sizeof(ASSET_MAGIC);
-    auto hostMagicWord = Endian::LeToH(*(reinterpret_cast<decltype(&ASSET_MAGIC)>(alignData.data())));
-    if (hostMagicWord != ASSET_MAGIC) {
-        return 0;
+    if (magic == ASSET_MAGIC) {
+        return ParserJsonAsset(data, length, asset);
     }
+    return 0;
+}
+
+size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, Assets &assets)
+{
+    auto magic = PeekMagic(data, length);
+    if (magic == ASSETS_BIN_MAGIC) {
+        return ParserBinaryAssets(data, length, assets);
+    }
+    if (magic == ASSETS_MAGIC) {
+        return ParserJsonAssets(data, length, assets);
+    }
+    return 0;
+}
 
-    if (sizeof(size) > length - used) {
+size_t RawDataParser::ParserBinaryAsset(const uint8_t *data, size_t length, Asset &asset)
+{
+    size_t used = 0;
+    uint32_t magic = 0;
+    uint16_t version = 0;
+    uint32_t size = 0;
+    if (!ReadLe(data, length, used, magic) || !ReadLe(data, length, used, version) ||
+        !ReadLe(data, length, used, size) || size > length - used) {
         return 0;
     }
-    alignData.assign(data + used, data + used + sizeof(size));
-    used += sizeof(size);
-    size = Endian::LeToH(*(reinterpret_cast<decltype(&size)>(alignData.data())));
-    if (size > length - used) {
+    // parse inside the payload only, the unknown fields of the later versions are skipped as a whole.
+    const uint8_t *payload = data + used;
+    size_t offset = 0;
+    if (!ReadLe(payload, size, offset, asset.version) || !ReadLe(payload, size, offset, asset.status) ||
+        !ReadLe(payload, size, offset, asset.expiresTime) || !ReadString(payload, size, offset, asset.id) ||
+        !ReadString(payload, size, offset, asset.name) || !ReadString(payload, size, offset, asset.uri) ||
+        !ReadString(payload, size, offset, asset.createTime) ||
+        !ReadString(payload, size, offset, asset.modifyTime) || !ReadString(payload, size, offset, asset.size) ||
+        !ReadString(payload, size, offset, asset.hash) || !ReadString(payload, size, offset, asset.path) ||
+        !ReadString(payload, size, offset, asset.extension)) {
+        return 0;
+    }
+    CheckExpires(asset);
+    return used + size;
+}
+
+size_t RawDataParser::ParserJsonAsset(const uint8_t *data, size_t length, Asset &asset)
+{
+    size_t used = 0;
+    uint32_t magic = 0;
+    uint16_t size = 0;
+    if (!ReadLe(data, length, used, magic) || !ReadLe(data, length, used, size) || size > length - used) {
         return 0;
     }
     auto rawData = std::string(reinterpret_cast<const char *>(&data[used]), size);
@@ -54,28 +142,39 @@ size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, Asset &a
     return used;
 }
 
-size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, Assets &assets)
+size_t RawDataParser::ParserBinaryAssets(const uint8_t *data, size_t length, Assets &assets)
 {
     size_t used = 0;
-    uint16_t num = 0;
-
-    if (sizeof(ASSETS_MAGIC) > length - used) {
+    uint32_t magic = 0;
+    uint16_t version = 0;
+    uint32_t num = 0;
+    if (!ReadLe(data, length, used, magic) || !ReadLe(data, length, used, version) ||
+        !ReadLe(data, length, used, num)) {
         return 0;
     }
-    std::vector<uint8_t> alignData;
-    alignData.assign(data, data + sizeof(ASSETS_MAGIC));
-    used += sizeof(ASSETS_MAGIC);
-    auto hostMagicWord = Endian::LeToH(*(reinterpret_cast<decltype(&ASSETS_MAGIC)>(alignData.data())));
-    if (hostMagicWord != ASSETS_MAGIC) {
-        return 0;
+    assets.reserve(assets.size() + std::min<size_t>(num, length - used));
+    uint32_t count = 0;
+    while (used < length && count < num) {
+        Asset asset;
+        auto dataLen = ParserRawData(&data[used], length - used, asset);
+        if (dataLen == 0) {
+            break;
+        }
+        used += dataLen;
+        assets.push_back(std::move(asset));
+        count++;
     }
+    return used;
+}
 
-    if (sizeof(num) > length - used) {
+size_t RawDataParser::ParserJsonAssets(const uint8_t *data, size_t length, Assets &assets)
+{
+    size_t used = 0;
+    uint32_t magic = 0;
+    uint16_t num = 0;
+    if (!ReadLe(data, length, used, magic) || !ReadLe(data, length, used, num)) {
         return 0;
     }
-    alignData.assign(data, data + sizeof(num));
-    num = Endian::LeToH(*(reinterpret_cast<decltype(&num)>(alignData.data())));
-    used += sizeof(num);
     uint16_t count = 0;
     while (used < length && count < num) {
         Asset asset;
@@ -90,7 +189,63 @@ size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, Assets &
     return used;
 }
 
+void RawDataParser::PackageBinaryAsset(const Asset &asset, std::vector<uint8_t> &rawData)
+{
+    WriteLe(rawData, ASSET_BIN_MAGIC);
+    WriteLe(rawData, BIN_VERSION);
+    auto sizePos = rawData.size();
+    WriteLe(rawData, uint32_t(0));
+    WriteLe(rawData, asset.version);
+    WriteLe(rawData, asset.status);
+    WriteLe(rawData, asset.expiresTime);
+    WriteString(rawData, asset.id);
+    WriteString(rawData, asset.name);
+    WriteString(rawData, asset.uri);
+    WriteString(rawData, asset.createTime);
+    WriteString(rawData, asset.modifyTime);
+    WriteString(rawData, asset.size);
+    WriteString(rawData, asset.hash);
+    WriteString(rawData, asset.path);
+    WriteString(rawData, asset.extension);
+    auto size = Endian::HToLe(static_cast<uint32_t>(rawData.size() - sizePos - sizeof(uint32_t)));
+    std::memcpy(rawData.data() + sizePos, &size, sizeof(size));
+}
+
+void RawDataParser::SetAssetFormat(AssetFormat format)
+{
+    assetFormat_ = format;
+}
+
 std::vector<uint8_t> RawDataParser::PackageRawData(const Asset &asset)
+{
+    return assetFormat_ == ASSET_FORMAT_BINARY ? PackageBinaryRawData(asset) : PackageJsonRawData(asset);
+}
+
+std::vector<uint8_t> RawDataParser::PackageRawData(const Assets &assets)
+{
+    return assetFormat_ == ASSET_FORMAT_BINARY ? PackageBinaryRawData(assets) : PackageJsonRawData(assets);
+}
+
+std::vector<uint8_t> RawDataParser::PackageBinaryRawData(const Asset &asset)
+{
+    std::vector<uint8_t> rawData;
+    PackageBinaryAsset(asset, rawData);
+    return rawData;
+}
+
+std::vector<uint8_t> RawDataParser::PackageBinaryRawData(const Assets &assets)
+{
+    std::vector<uint8_t> rawData;
+    WriteLe(rawData, ASSETS_BIN_MAGIC);
+    WriteLe(rawData, BIN_VERSION);
+    WriteLe(rawData, static_cast<uint32_t>(assets.size()));
+    for (auto &asset : assets) {
+        PackageBinaryAsset(asset, rawData);
+    }
+    return rawData;
+}
+
+std::vector<uint8_t> RawDataParser::PackageJsonRawData(const Asset &asset)
 {
     std::vector<uint8_t> rawData;
     InnerAsset innerAsset(const_cast<Asset &>(asset));
@@ -105,21 +260,29 @@ std::vector<uint8_t> RawDataParser::PackageRawData(const Asset &asset)
     return rawData;
 }
 
-std::vector<uint8_t> RawDataParser::PackageRawData(const Assets &assets)
+std::vector<uint8_t> RawDataParser::PackageJsonRawData(const Assets &assets)
 {
     std::vector<uint8_t> rawData;
-    uint16_t num = uint16_t(assets.size());
+    uint16_t num = Endian::HToLe(uint16_t(assets.size()));
     auto leMagic = Endian::HToLe(ASSETS_MAGIC);
     auto magicU8 = reinterpret_cast<uint8_t *>(const_cast<uint32_t *>(&leMagic));
     rawData.insert(rawData.end(), magicU8, magicU8 + sizeof(ASSETS_MAGIC));
     rawData.insert(rawData.end(), reinterpret_cast<uint8_t *>(&num), reinterpret_cast<uint8_t *>(&num) + sizeof(num));
     for (auto &asset : assets) {
-        auto data = PackageRawData(asset);
+        auto data = PackageJsonRawData(asset);
         rawData.insert(rawData.end(), data.begin(), data.end());
     }
     return rawData;
 }
 
+void RawDataParser::CheckExpires(Asset &asset)
+{
+    if (asset.status == AssetValue::STATUS_DOWNLOADING &&
+        asset.expiresTime < static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count())) {
+        asset.status = AssetValue::STATUS_ABNORMAL;
+    }
+}
+
 size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, std::map<std::string, Asset> &assets)
 {
     Assets res;
@@ -210,6 +373,20 @@ size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, RawDataP
     return used;
 }
 
+size_t RawDataParser::ParserRawData(const uint8_t *data, size_t length, const uint8_t *&values, uint32_t &count)
+{
+    size_t used = 0;
+    uint32_t magic = 0;
+    if (!ReadLe(data, length, used, magic) || magic != FLOUT32_ARRAY || !ReadLe(data, length, used, count)) {
+        return 0;
+    }
+    if (count > (length - used) / sizeof(float)) {
+        return 0;
+    }
+    values = data + used;
+    return used + sizeof(float) * count;
+}
+
 std::vector<uint8_t> RawDataParser::PackageRawData(const std::map<std::string, Asset> &assets)
 {
     Assets res;
@@ -290,10 +467,7 @@ bool RawDataParser::InnerAsset::Unmarshal(const Serializable::json &node)
     ret = GetValue(node, GET_NAME(path), asset_.path) && ret;
     ret = GetValue(node, GET_NAME(status), asset_.status) && ret;
     GetValue(node, GET_NAME(extension), asset_.extension);
-    if (asset_.status == AssetValue::STATUS_DOWNLOADING &&
-        asset_.expiresTime < static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count())) {
-        asset_.status = AssetValue::STATUS_ABNORMAL;
-    }
+    CheckExpires(asset_);
     return ret;
 }
 } // namespace OHOS::NativeRdb
\ No newline at end of file
@@ -28,6 +28,7 @@
 #include "unistd.h"
 #if !defined(WINDOWS_PLATFORM) && !defined(MAC_PLATFORM) && !defined(ANDROID_PLATFORM) && !defined(IOS_PLATFORM)
 #include "security_policy.h"
+#include "shared_block_pool.h"
 #endif
 #include "rdb_fault_hiview_reporter.h"
 
@@ -60,6 +61,9 @@ void RdbHelper::ClearCache()
 {
     DISTRIBUTED_DATA_HITRACE(std::string(__FUNCTION__));
     RdbStoreManager::GetInstance().Clear();
+#if !defined(WINDOWS_PLATFORM) && !defined(MAC_PLATFORM) && !defined(ANDROID_PLATFORM) && !defined(IOS_PLATFORM)
+    SharedBlockPool::GetInstance().Trim(true);
+#endif
 }
 
 bool RdbHelper::Init()
@@ -32,6 +32,7 @@ std::shared_mutex PerfStat::mutex_;
 std::map<uint64_t, PerfStat::ThreadParam> PerfStat::threadParams_;
 ConcurrentMap<std::string, std::set<std::shared_ptr<SqlObserver>>> PerfStat::observers_;
 ConcurrentMap<uint64_t, std::shared_ptr<SqlExecInfo>> PerfStat::execInfos_;
+ConcurrentMap<std::string, std::weak_ptr<PerfStat::StmtCacheStat>> PerfStat::stmtCacheStats_;
 bool PerfStat::enabled_ = false;
 std::atomic_uint32_t PerfStat::seqId_ = 0;
 int PerfStat::Subscribe(const std::string &storeId, std::shared_ptr<SqlObserver> observer)
@@ -225,6 +226,34 @@ void PerfStat::Resume(uint32_t seqId)
     threadParams_[GetThreadId()].suspenders_ = std::max(0, threadParams_[GetThreadId()].suspenders_ - 1);
 }
 
+std::shared_ptr<PerfStat::StmtCacheStat> PerfStat::GetStmtCacheStat(const std::string &storeId)
+{
+    std::shared_ptr<StmtCacheStat> stat;
+    stmtCacheStats_.Compute(storeId, [&stat](const auto &, auto &weakStat) {
+        stat = weakStat.lock();
+        if (stat == nullptr) {
+            stat = std::make_shared<StmtCacheStat>();
+            weakStat = stat;
+        }
+        return true;
+    });
+    return stat;
+}
+
+std::pair<uint64_t, uint64_t> PerfStat::GetStmtCacheCounts(const std::string &storeId)
+{
+    std::pair<uint64_t, uint64_t> counts = { 0, 0 };
+    stmtCacheStats_.ComputeIfPresent(storeId, [&counts](const auto &, auto &weakStat) {
+        auto stat = weakStat.lock();
+        if (stat == nullptr) {
+            return false;
+        }
+        counts = { stat->hits_.load(), stat->misses_.load() };
+        return true;
+    });
+    return counts;
+}
+
 void PerfStat::FormatSql(const std::string &sql)
 {
     auto size = GetSize();
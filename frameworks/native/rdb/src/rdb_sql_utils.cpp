@@ -384,13 +384,9 @@ bool RdbSqlUtils::HasDuplicateAssets(const ValuesBucket &value)
 
 bool RdbSqlUtils::HasDuplicateAssets(const ValuesBuckets &values)
 {
-    const auto &[fields, vals] = values.GetFieldsAndValues();
-    for (const auto &valueObject : *vals) {
-        if (HasDuplicateAssets(valueObject)) {
-            return true;
-        }
-    }
-    return false;
+    return values.AnyOf([](const ValueObject &value) {
+        return HasDuplicateAssets(value);
+    });
 }
 } // namespace NativeRdb
 } // namespace OHOS
\ No newline at end of file
@@ -286,6 +286,14 @@ std::shared_ptr<AbsSharedResultSet> RdbStore::QuerySql(const std::string &sql, c
     return QuerySql(sql, ToValues(args));
 }
 
+std::shared_ptr<AbsSharedResultSet> RdbStore::QuerySql(const std::string &sql, const Values &args,
+    const QueryOptions &options)
+{
+    // only the stores that support the lazy count override it, the others count the rows in advance.
+    (void)options;
+    return QuerySql(sql, args);
+}
+
 std::shared_ptr<ResultSet> RdbStore::QueryByStep(const std::string &sql, const Olds &args)
 {
     return QueryByStep(sql, ToValues(args));
@@ -658,6 +658,16 @@ void RdbStoreConfig::SetHaMode(int32_t haMode)
     haMode_ = haMode;
 }
 
+bool RdbStoreConfig::IsAsyncReplication() const
+{
+    return asyncReplication_;
+}
+
+void RdbStoreConfig::SetAsyncReplication(bool isAsync)
+{
+    asyncReplication_ = isAsync;
+}
+
 PromiseInfo RdbStoreConfig::GetPromiseInfo() const
 {
     return promiseInfo_;
@@ -836,6 +846,7 @@ std::string RdbStoreConfig::ToString() const
     oss << " dbType:" << dbType_ << ",";
     oss << " customDir:" << SqliteUtils::Anonymous(customDir_) << ",";
     oss << " haMode:" << haMode_ << ",";
+    oss << " asyncReplication:" << asyncReplication_ << ",";
     oss << " pluginLibs size:" << pluginLibs_.size() << ",";
     oss << " area:" << area_ << ",";
     oss << " serverPath:" << SqliteUtils::Anonymous(serverPath_) << ",";
@@ -861,6 +872,7 @@ std::string RdbStoreConfig::FormatCfg(const RdbStoreConfig &first, const RdbStor
     oss << " customDir:" << SqliteUtils::Anonymous(first.customDir_) << "->"
         << SqliteUtils::Anonymous(second.customDir_) << ",";
     oss << " haMode:" << first.haMode_ << "->" << second.haMode_ << ",";
+    oss << " asyncReplication:" << first.asyncReplication_ << "->" << second.asyncReplication_ << ",";
     oss << " pluginLibs size:" << first.pluginLibs_.size() << "->" << second.pluginLibs_.size() << ",";
     oss << " area:" << first.area_ << "->" << second.area_ << ",";
     oss << " serverPath:" << SqliteUtils::Anonymous(first.serverPath_) << "->"
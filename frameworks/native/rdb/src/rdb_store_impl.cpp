@@ -1680,21 +1680,25 @@ std::pair<int, int64_t> RdbStoreImpl::BatchInsert(const std::string &table, cons
         return { E_DATABASE_BUSY, -1 };
     }
 
-    auto executeSqlArgs = SqliteSqlBuilder::GenerateSqls(table, rows, conn->GetMaxVariable());
-    BatchInsertArgsDfx(static_cast<int>(executeSqlArgs.size()));
-    if (executeSqlArgs.empty()) {
+    // the statements of the full chunk and the remaining rows are reused by the statement cache of the connection.
+    auto batchSqls = SqliteSqlBuilder::GenerateBatchSqls(table, rows, conn->GetMaxVariable());
+    BatchInsertArgsDfx(static_cast<int>(batchSqls.size()));
+    if (batchSqls.empty()) {
         return { E_INVALID_ARGS, -1 };
     }
     PauseDelayNotify pauseDelayNotify(delayNotifier_);
-    for (const auto &[sql, bindArgs] : executeSqlArgs) {
+    std::vector<SqliteSqlBuilder::RefValue> args;
+    size_t begin = 0;
+    for (const auto &[sql, chunkRows, times] : batchSqls) {
         auto [errCode, statement] = GetStatement(sql, conn);
         if (statement == nullptr) {
-            LOG_ERROR("statement is nullptr, errCode:0x%{public}x, args:%{public}zu, table:%{public}s, "
+            LOG_ERROR("statement is nullptr, errCode:0x%{public}x, times:%{public}zu, table:%{public}s, "
                       "app self can check the SQL",
-                errCode, bindArgs.size(), SqliteUtils::Anonymous(table).c_str());
+                errCode, times, SqliteUtils::Anonymous(table).c_str());
             return { E_OK, -1 };
         }
-        for (const auto &args : bindArgs) {
+        for (size_t i = 0; i < times; ++i, begin += chunkRows) {
+            SqliteSqlBuilder::FillBatchArgs(rows, begin, chunkRows, args);
             auto errCode = statement->Execute(args);
             if (errCode == E_SQLITE_LOCKED || errCode == E_SQLITE_BUSY) {
                 pool->Dump(true, "BATCH");
@@ -1702,7 +1706,7 @@ std::pair<int, int64_t> RdbStoreImpl::BatchInsert(const std::string &table, cons
             }
             if (errCode != E_OK) {
                 LOG_ERROR("failed, errCode:%{public}d,args:%{public}zu,table:%{public}s,app self can check the SQL",
-                    errCode, bindArgs.size(), SqliteUtils::Anonymous(table).c_str());
+                    errCode, args.size(), SqliteUtils::Anonymous(table).c_str());
                 return { E_OK, -1 };
             }
         }
@@ -1741,38 +1745,40 @@ std::pair<int32_t, Results> RdbStoreImpl::BatchInsert(
         return { code, -1 };
     }
 
-    auto sqlArgs = SqliteSqlBuilder::GenerateSqls(table, rows, conn->GetMaxVariable(), resolution);
+    auto batchSqls = SqliteSqlBuilder::GenerateBatchSqls(table, rows, conn->GetMaxVariable(), resolution);
     // To ensure atomicity, execute SQL only once
-    if (sqlArgs.size() != 1 || sqlArgs.front().second.size() != 1 ||
+    if (batchSqls.size() != 1 || batchSqls.front().times != 1 ||
         !RdbSqlUtils::IsValidReturningMaxCount(config.maxReturningCount)) {
-        auto [fields, values] = rows.GetFieldsAndValues();
+        auto fields = rows.GetFields();
         LOG_ERROR("invalid! rows:%{public}zu, table:%{public}s, fields:%{public}zu, max:%{public}d.", rows.RowSize(),
             SqliteUtils::Anonymous(table).c_str(), fields != nullptr ? fields->size() : 0, conn->GetMaxVariable());
         return { E_INVALID_ARGS, -1 };
     }
-    auto [errCode, result] = ExecuteBatchInsertReturning(sqlArgs, conn, config, resolution);
+    std::vector<SqliteSqlBuilder::RefValue> args;
+    SqliteSqlBuilder::FillBatchArgs(rows, 0, batchSqls.front().rows, args);
+    auto [errCode, result] = ExecuteBatchInsertReturning(batchSqls.front().sql, args, conn, config, resolution);
     if (result.changed > 0) {
         DoCloudSync(table);
     }
     return { errCode, result };
 }
 
-std::pair<int32_t, Results> RdbStoreImpl::ExecuteBatchInsertReturning(const RdbStoreImpl::BatchSqlArgs &sqlArgs,
-    const std::shared_ptr<Connection> &conn, const ReturningConfig &config, Resolution resolution)
+std::pair<int32_t, Results> RdbStoreImpl::ExecuteBatchInsertReturning(const std::string &sql,
+    const std::vector<std::reference_wrapper<ValueObject>> &args, const std::shared_ptr<Connection> &conn,
+    const ReturningConfig &config, Resolution resolution)
 {
-    auto &[sql, bindArgs] = sqlArgs.front();
     auto returningSql = SqliteSqlBuilder::GetReturningSql(config.columns);
     auto [errCode, statement] = GetStatement(sql, conn, returningSql);
     if (statement == nullptr) {
         LOG_ERROR("statement is nullptr, errCode:0x%{public}x, args:%{public}zu, "
                   "app self can check the SQL",
-            errCode, bindArgs.size());
+            errCode, args.size());
         SetLastErrorMsg(conn->GetLastErrorMsg());
         return { errCode, -1 };
     }
     PauseDelayNotify pauseDelayNotify(delayNotifier_);
-    std::vector<ValuesBucket> values;
-    std::tie(errCode, values) = statement->ExecuteForRows(std::ref(bindArgs.front()), config.maxReturningCount);
+    ReturningRows values;
+    std::tie(errCode, values) = statement->ExecuteForReturning(args, config.maxReturningCount);
     if (errCode == E_SQLITE_LOCKED || errCode == E_SQLITE_BUSY) {
         TryDump(errCode, "BATCH");
         return { errCode, -1 };
@@ -1780,7 +1786,7 @@ std::pair<int32_t, Results> RdbStoreImpl::ExecuteBatchInsertReturning(const RdbS
     if (errCode != E_OK) {
         SetLastErrorMsg(statement->GetLastErrorMsg());
         LOG_ERROR("failed,errCode:%{public}d,args:%{public}zu,resolution:%{public}d.", errCode,
-            bindArgs.front().size(), static_cast<int32_t>(resolution));
+            args.size(), static_cast<int32_t>(resolution));
     }
     Results result;
     std::tie(errCode, result) = GenerateResult(errCode, statement, std::move(values), true, config.defaultRowIndex);
@@ -1831,11 +1837,14 @@ std::pair<int32_t, Results> RdbStoreImpl::Delete(const AbsRdbPredicates &predica
 }
 
 std::shared_ptr<AbsSharedResultSet> RdbStoreImpl::QuerySql(const std::string &sql, const Values &bindArgs)
+{
+    return QuerySql(sql, bindArgs, QueryOptions());
+}
+
+std::shared_ptr<AbsSharedResultSet> RdbStoreImpl::QuerySql(
+    const std::string &sql, const Values &bindArgs, const QueryOptions &options)
 {
     DISTRIBUTED_DATA_HITRACE(std::string(__FUNCTION__));
-    if (config_.GetDBType() == DB_VECTOR) {
-        return nullptr;
-    }
     SqlStatistic sqlStatistic("", SqlStatistic::Step::STEP_TOTAL);
     PerfStat perfStat(config_.GetPath(), "", PerfStat::Step::STEP_TOTAL);
 #if !defined(CROSS_PLATFORM)
@@ -1845,10 +1854,11 @@ std::shared_ptr<AbsSharedResultSet> RdbStoreImpl::QuerySql(const std::string &sq
         LOG_ERROR("Database already closed.");
         return nullptr;
     }
-    return std::make_shared<SqliteSharedResultSet>(start, pool->AcquireRef(true), sql, bindArgs, path_);
+    return std::make_shared<SqliteSharedResultSet>(start, pool->AcquireRef(true), sql, bindArgs, path_, options);
 #else
     (void)sql;
     (void)bindArgs;
+    (void)options;
     return nullptr;
 #endif
 }
@@ -2047,8 +2057,8 @@ std::pair<int32_t, Results> RdbStoreImpl::ExecuteExt(const std::string &sql, con
     if (errCode != E_OK) {
         return { errCode, -1 };
     }
-    std::vector<ValuesBucket> rows;
-    std::tie(errCode, rows) = statement->ExecuteForRows(args, ReturningConfig::DEFAULT_RETURNING_COUNT);
+    ReturningRows rows;
+    std::tie(errCode, rows) = statement->ExecuteForReturning(args, ReturningConfig::DEFAULT_RETURNING_COUNT);
     TryDump(errCode, "ExecuteExt");
     Results result;
     std::tie(errCode, result) = GenerateResult(errCode, statement, std::move(rows),
@@ -2148,8 +2158,8 @@ std::pair<int32_t, Results> RdbStoreImpl::ExecuteForRow(
     if (statement == nullptr) {
         return { errCode, -1 };
     }
-    std::vector<ValuesBucket> values;
-    std::tie(errCode, values) = statement->ExecuteForRows(args, config.maxReturningCount);
+    ReturningRows values;
+    std::tie(errCode, values) = statement->ExecuteForReturning(args, config.maxReturningCount);
     TryDump(errCode, "UPG DEL");
     return GenerateResult(errCode, statement, std::move(values), true, config.defaultRowIndex);
 }
@@ -3467,7 +3477,7 @@ int RdbStoreImpl::DeleteSyncedData(const std::string &table, const std::vector<s
 }
 
 std::pair<int32_t, Results> RdbStoreImpl::GenerateResult(int32_t code, std::shared_ptr<Statement> statement,
-    std::vector<ValuesBucket> &&returningValues, bool isDML, int32_t rowIndex)
+    ReturningRows &&returningRows, bool isDML, int32_t rowIndex)
 {
     Results result{ -1 };
     if (statement == nullptr) {
@@ -3475,7 +3485,8 @@ std::pair<int32_t, Results> RdbStoreImpl::GenerateResult(int32_t code, std::shar
     }
     // There are no data changes in other scenarios
     if (code == E_OK) {
-        std::shared_ptr<ResultSet> resultSet = std::make_shared<CacheResultSet>(std::move(returningValues), rowIndex);
+        std::shared_ptr<ResultSet> resultSet = std::make_shared<CacheResultSet>(
+            std::move(returningRows.columns), std::move(returningRows.values), rowIndex);
         result.results = resultSet;
         result.changed = isDML ? statement->Changes() : 0;
     }
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define LOG_TAG "SharedBlockPool"
+#include "shared_block_pool.h"
+
+#include "logger.h"
+
+namespace OHOS {
+namespace NativeRdb {
+using namespace OHOS::Rdb;
+
+SharedBlockPool &SharedBlockPool::GetInstance()
+{
+    // never destroyed, the blocks may be released by the other static objects during the exit.
+    static SharedBlockPool *instance = new SharedBlockPool();
+    return *instance;
+}
+
+size_t SharedBlockPool::GetClassSize(size_t size)
+{
+    if (size > MAX_CLASS_SIZE) {
+        return 0;
+    }
+    size_t classSize = MIN_CLASS_SIZE;
+    while (classSize < size) {
+        classSize <<= 1;
+    }
+    return classSize;
+}
+
+std::pair<int, std::shared_ptr<SharedBlockPool::SharedBlock>> SharedBlockPool::Acquire(
+    const std::string &name, size_t size)
+{
+    SharedBlock *block = nullptr;
+    auto classSize = GetClassSize(size);
+    if (classSize == 0) {
+        auto errCode = SharedBlock::CreateLocal(name, size, block);
+        if (errCode != SharedBlock::SHARED_BLOCK_OK) {
+            return { errCode, nullptr };
+        }
+        return { SharedBlock::SHARED_BLOCK_OK, std::shared_ptr<SharedBlock>(block) };
+    }
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        auto it = idles_.find(classSize);
+        if (it != idles_.end() && !it->second.empty()) {
+            block = it->second.back().block;
+            it->second.pop_back();
+            stats_.idleBlocks--;
+            stats_.idleBytes -= classSize;
+            stats_.hits++;
+        } else {
+            stats_.misses++;
+        }
+    }
+
+    if (block == nullptr) {
+        auto errCode = SharedBlock::CreateLocal(name, classSize, block);
+        if (errCode != SharedBlock::SHARED_BLOCK_OK) {
+            return { errCode, nullptr };
+        }
+    } else {
+        // the idle blocks are all local, so the name of the previous owner is replaced.
+        block->Rename(name);
+    }
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        stats_.usingBlocks++;
+        stats_.usingBytes += classSize;
+    }
+    return { SharedBlock::SHARED_BLOCK_OK, std::shared_ptr<SharedBlock>(block, [](SharedBlock *block) {
+        SharedBlockPool::GetInstance().Release(block);
+    }) };
+}
+
+void SharedBlockPool::Release(SharedBlock *block)
+{
+    if (block == nullptr) {
+        return;
+    }
+    auto classSize = block->Size();
+    // the block which has been handed out can not be recycled.
+    bool reusable = block->Recycle() == SharedBlock::SHARED_BLOCK_OK;
+    std::vector<SharedBlock *> expired;
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        stats_.usingBlocks--;
+        stats_.usingBytes -= classSize;
+        if (reusable) {
+            idles_[classSize].push_back({ block, std::chrono::steady_clock::now() });
+            stats_.idleBlocks++;
+            stats_.idleBytes += classSize;
+            block = nullptr;
+        }
+        while (stats_.idleBytes > MAX_IDLE_BYTES) {
+            auto oldest = idles_.end();
+            for (auto it = idles_.begin(); it != idles_.end(); ++it) {
+                if (!it->second.empty() &&
+                    (oldest == idles_.end() || it->second.front().time < oldest->second.front().time)) {
+                    oldest = it;
+                }
+            }
+            if (oldest == idles_.end()) {
+                break;
+            }
+            expired.push_back(oldest->second.front().block);
+            oldest->second.pop_front();
+            stats_.idleBlocks--;
+            stats_.idleBytes -= oldest->first;
+            stats_.trimmed++;
+        }
+        ScheduleTrim();
+    }
+    delete block;
+    for (auto expiredBlock : expired) {
+        delete expiredBlock;
+    }
+}
+
+void SharedBlockPool::Trim(bool force)
+{
+    std::vector<SharedBlock *> expired;
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        auto now = std::chrono::steady_clock::now();
+        for (auto &[classSize, idles] : idles_) {
+            while (!idles.empty() && (force || now - idles.front().time >= IDLE_TIMEOUT)) {
+                expired.push_back(idles.front().block);
+                idles.pop_front();
+                stats_.idleBlocks--;
+                stats_.idleBytes -= classSize;
+                stats_.trimmed++;
+            }
+        }
+    }
+    for (auto block : expired) {
+        delete block;
+    }
+}
+
+SharedBlockPool::Stats SharedBlockPool::GetStats()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return stats_;
+}
+
+void SharedBlockPool::ScheduleTrim()
+{
+    if (trimTaskId_ != TaskExecutor::INVALID_TASK_ID || stats_.idleBlocks == 0) {
+        return;
+    }
+    auto executor = TaskExecutor::GetInstance().GetExecutor();
+    if (executor == nullptr) {
+        return;
+    }
+    trimTaskId_ = executor->Schedule(IDLE_TIMEOUT, []() {
+        auto &pool = SharedBlockPool::GetInstance();
+        pool.Trim();
+        std::lock_guard<decltype(pool.mutex_)> lock(pool.mutex_);
+        pool.trimTaskId_ = TaskExecutor::INVALID_TASK_ID;
+        pool.ScheduleTrim();
+    });
+}
+} // namespace NativeRdb
+} // namespace OHOS
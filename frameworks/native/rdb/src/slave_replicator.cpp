@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define LOG_TAG "SlaveReplicator"
+#include "slave_replicator.h"
+
+#include <algorithm>
+
+#include "logger.h"
+#include "rdb_errno.h"
+#include "sqlite_connection.h"
+#include "sqlite_utils.h"
+
+namespace OHOS {
+namespace NativeRdb {
+using namespace OHOS::Rdb;
+
+SlaveReplicator::SlaveReplicator(const std::string &path) : path_(path)
+{
+}
+
+void SlaveReplicator::Attach(std::shared_ptr<SqliteConnection> slave)
+{
+    if (slave == nullptr) {
+        return;
+    }
+    std::lock_guard<decltype(applyMutex_)> lock(applyMutex_);
+    slave_ = std::move(slave);
+}
+
+SlaveReplicator::Recorder::Recorder(std::shared_ptr<SlaveReplicator> replicator) : replicator_(std::move(replicator))
+{
+}
+
+void SlaveReplicator::Recorder::Append(const std::string &sql, const Values &args, bool readOnly, bool autoCommit)
+{
+    int type = SqliteUtils::GetSqlStatementType(sql);
+    if (readOnly && (type == SqliteUtils::STATEMENT_SELECT || type == SqliteUtils::STATEMENT_PRAGMA ||
+        (type == SqliteUtils::STATEMENT_OTHER && current_.empty()))) {
+        return;
+    }
+    if (type == SqliteUtils::STATEMENT_ROLLBACK && autoCommit) {
+        current_.clear();
+        return;
+    }
+    Op op = { sql, {}, type };
+    op.args.reserve(args.size());
+    for (auto &arg : args) {
+        op.args.push_back(arg.get());
+    }
+    if (!autoCommit) {
+        current_.push_back(std::move(op));
+        if (!replicator_->Hold(current_)) {
+            current_.clear();
+        }
+        return;
+    }
+    // the transaction has been rolled back by the main database without the ROLLBACK statement.
+    if (!current_.empty() && type != SqliteUtils::STATEMENT_COMMIT && type != SqliteUtils::STATEMENT_OTHER) {
+        current_.clear();
+    }
+    current_.push_back(std::move(op));
+    std::vector<Op> ops;
+    ops.swap(current_);
+    std::lock_guard<decltype(replicator_->mutex_)> lock(replicator_->mutex_);
+    if (!replicator_->invalid_) {
+        replicator_->Commit(std::move(ops));
+    }
+}
+
+int32_t SlaveReplicator::Flush()
+{
+    return Apply(true);
+}
+
+void SlaveReplicator::Suspend()
+{
+    Apply(true);
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    suspended_++;
+    droppedUnits_ += units_.size();
+    units_.clear();
+    pendingOps_ = 0;
+}
+
+void SlaveReplicator::Resume()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    if (suspended_ > 0) {
+        suspended_--;
+    }
+    if (suspended_ == 0) {
+        // the slave state is decided by the backup, start over from it.
+        invalid_ = false;
+        marked_ = false;
+    }
+}
+
+SlaveReplicator::Stats SlaveReplicator::GetStats()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    Stats stats;
+    stats.pendingUnits = units_.size() + applyingUnits_;
+    stats.pendingOps = pendingOps_ + applyingOps_;
+    stats.appliedUnits = appliedUnits_;
+    stats.droppedUnits = droppedUnits_;
+    if (stats.pendingUnits != 0) {
+        auto oldest = applyingUnits_ != 0 ? applyingTime_ : units_.front().time;
+        stats.lagMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - oldest).count();
+    }
+    return stats;
+}
+
+bool SlaveReplicator::IsGroupable(const Unit &unit)
+{
+    if (unit.ops.size() != 1) {
+        return false;
+    }
+    auto type = unit.ops.front().type;
+    return type == SqliteUtils::STATEMENT_INSERT || type == SqliteUtils::STATEMENT_UPDATE ||
+           type == SqliteUtils::STATEMENT_DDL;
+}
+
+// Checks the open transaction of a recorder can still be replayed, it is dropped if not.
+bool SlaveReplicator::Hold(std::vector<Op> &ops)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    if (invalid_) {
+        return false;
+    }
+    if (pendingOps_ + applyingOps_ + ops.size() > MAX_PENDING_OPS) {
+        Abandon();
+        return false;
+    }
+    return true;
+}
+
+void SlaveReplicator::Commit(std::vector<Op> &&ops)
+{
+    if (suspended_ > 0) {
+        droppedUnits_++;
+        return;
+    }
+    if (!marked_) {
+        // the slave is incomplete already, it will be rebuilt by the backup.
+        if (SqliteUtils::IsSlaveInterrupted(path_) || SqliteUtils::IsSlaveInvalid(path_)) {
+            invalid_ = true;
+            droppedUnits_++;
+            return;
+        }
+        SqliteUtils::SetSlaveInterrupted(path_);
+        marked_ = true;
+    }
+    pendingOps_ += ops.size();
+    units_.push_back({ std::move(ops), std::chrono::steady_clock::now() });
+    if (pendingOps_ + applyingOps_ > MAX_PENDING_OPS) {
+        Abandon();
+        return;
+    }
+    Schedule();
+}
+
+void SlaveReplicator::Schedule()
+{
+    if (taskId_ != TaskExecutor::INVALID_TASK_ID || units_.empty()) {
+        return;
+    }
+    auto executor = TaskExecutor::GetInstance().GetExecutor();
+    if (executor == nullptr) {
+        LOG_WARN("task pool err, pending:%{public}zu", units_.size());
+        return;
+    }
+    std::weak_ptr<SlaveReplicator> weak = shared_from_this();
+    taskId_ = executor->Execute([weak]() {
+        auto replicator = weak.lock();
+        if (replicator != nullptr) {
+            replicator->Apply(false);
+        }
+    });
+}
+
+int32_t SlaveReplicator::Apply(bool isFlush)
+{
+    std::lock_guard<decltype(applyMutex_)> applyLock(applyMutex_);
+    int32_t errCode = E_OK;
+    while (true) {
+        std::list<Unit> units;
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            if (units_.empty() || suspended_ > 0 || errCode != E_OK) {
+                if (!isFlush) {
+                    taskId_ = TaskExecutor::INVALID_TASK_ID;
+                }
+                ClearMark();
+                return errCode;
+            }
+            units.swap(units_);
+            applyingUnits_ = units.size();
+            applyingOps_ = pendingOps_;
+            applyingTime_ = units.front().time;
+            pendingOps_ = 0;
+        }
+        errCode = ApplyUnits(units);
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        applyingUnits_ = 0;
+        applyingOps_ = 0;
+        if (errCode != E_OK) {
+            droppedUnits_ += units.size();
+            Abandon();
+        } else {
+            appliedUnits_ += units.size();
+        }
+    }
+}
+
+int32_t SlaveReplicator::ApplyUnits(std::list<Unit> &units)
+{
+    auto it = units.begin();
+    while (it != units.end()) {
+        if (IsGroupable(*it)) {
+            auto end = std::find_if_not(it, units.end(), IsGroupable);
+            auto errCode = ApplyGroup(it, end);
+            if (errCode != E_OK) {
+                return errCode;
+            }
+            it = end;
+            continue;
+        }
+        for (auto &op : it->ops) {
+            auto errCode = Execute(op.sql, op.args);
+            if (errCode != E_OK) {
+                LOG_ERROR("replay failed:%{public}d, sql:%{public}s", errCode,
+                    SqliteUtils::SqlAnonymous(op.sql).c_str());
+                (void)Execute("ROLLBACK");
+                return errCode;
+            }
+        }
+        ++it;
+    }
+    return E_OK;
+}
+
+int32_t SlaveReplicator::ApplyGroup(std::list<Unit>::iterator begin, std::list<Unit>::iterator end)
+{
+    // the single statement units are replayed in one slave transaction to save the fsync.
+    bool isGroup = std::next(begin) != end;
+    if (isGroup) {
+        auto errCode = Execute("BEGIN IMMEDIATE");
+        if (errCode != E_OK) {
+            return errCode;
+        }
+    }
+    for (auto it = begin; it != end; ++it) {
+        auto &op = it->ops.front();
+        auto errCode = Execute(op.sql, op.args);
+        if (errCode != E_OK) {
+            LOG_ERROR("replay failed:%{public}d, sql:%{public}s", errCode, SqliteUtils::SqlAnonymous(op.sql).c_str());
+            if (isGroup) {
+                (void)Execute("ROLLBACK");
+            }
+            return errCode;
+        }
+    }
+    return isGroup ? Execute("COMMIT") : E_OK;
+}
+
+int32_t SlaveReplicator::Execute(const std::string &sql, const std::vector<ValueObject> &args)
+{
+    if (slave_ == nullptr) {
+        return E_ALREADY_CLOSED;
+    }
+    auto [errCode, statement] = slave_->CreateStatement(sql, nullptr);
+    if (statement == nullptr) {
+        return errCode == E_OK ? E_ERROR : errCode;
+    }
+    return statement->Execute(args);
+}
+
+void SlaveReplicator::Abandon()
+{
+    LOG_WARN("stop replaying, pending:%{public}zu, ops:%{public}zu", units_.size(), pendingOps_);
+    SqliteUtils::SetSlaveInvalid(path_);
+    droppedUnits_ += units_.size();
+    units_.clear();
+    pendingOps_ = 0;
+    invalid_ = true;
+}
+
+void SlaveReplicator::ClearMark()
+{
+    if (!marked_ || invalid_ || suspended_ > 0 || applyingUnits_ != 0 || !units_.empty()) {
+        return;
+    }
+    SqliteUtils::SetSlaveInterrupted(path_, false);
+    marked_ = false;
+}
+} // namespace NativeRdb
+} // namespace OHOS
@@ -22,7 +22,9 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -78,6 +80,8 @@ constexpr int32_t BINLOG_FILE_REPLAY_LIMIT = 50;
 constexpr int64_t BINLOG_REPLAY_REPORT_TIME = 15 * 60 * 1000; // ms
 constexpr char const *SUFFIX_BINLOG = "_binlog/";
 ConcurrentMap<uint64_t, Connection::ReplayCallBack> SqliteConnection::replayCallback_ = {};
+std::mutex SqliteConnection::walStatesMutex_;
+std::map<std::string, std::weak_ptr<SqliteConnection::WalState>> SqliteConnection::walStates_;
 __attribute__((used))
 const int32_t SqliteConnection::regCreator_ = Connection::RegisterCreator(DB_SQLITE, SqliteConnection::Create);
 __attribute__((used))
@@ -334,6 +338,7 @@ int SqliteConnection::InnerOpen(const RdbStoreConfig &config)
     if (errCode != E_OK) {
         return errCode;
     }
+    stmtCache_ = std::make_shared<SqliteStatementCache>(DistributedRdb::PerfStat::GetStmtCacheStat(config.GetPath()));
 
     if (isWriter_) {
         ValueObject checkResult{ "ok" };
@@ -504,6 +509,7 @@ int SqliteConnection::Configure(const RdbStoreConfig &config, std::string &dbPat
     if (errCode != E_OK) {
         return errCode;
     }
+    SetWalHook(config);
 
     errCode = SetCustomFunctions(config);
     if (errCode != E_OK) {
@@ -521,6 +527,14 @@ SqliteConnection::~SqliteConnection()
             pool->Remove(backupId_, true);
         }
     }
+    if (replicator_ != nullptr) {
+        replicator_->Flush();
+    }
+    if (stmtCache_ != nullptr) {
+        LOG_DEBUG("Statement cache hits:%{public}" PRIu64 ", misses:%{public}" PRIu64 ".", stmtCache_->GetHits(),
+            stmtCache_->GetMisses());
+        stmtCache_->Clear();
+    }
     if (dbHandle_ != nullptr) {
         int errCode = sqlite3_close_v2(dbHandle_);
         if (errCode != SQLITE_OK) {
@@ -564,6 +578,7 @@ int32_t SqliteConnection::RegisterHookIfNecessary()
 int SqliteConnection::RegisterStoreObs()
 {
     RegisterDbHook(dbHandle_);
+    walHooked_ = false;
     auto status = CreateDataChangeTempTrigger(dbHandle_);
     if (status != E_OK) {
         LOG_ERROR("CreateDataChangeTempTrigger failed. status %{public}d", status);
@@ -575,6 +590,7 @@ int SqliteConnection::RegisterStoreObs()
 int SqliteConnection::RegisterClientObs()
 {
     RegisterDbHook(dbHandle_);
+    walHooked_ = false;
     return E_OK;
 }
 
@@ -633,6 +649,15 @@ std::pair<int, std::shared_ptr<Statement>> SqliteConnection::CreateStatementInne
     if (sql == INTEGRITIES[1] && db != nullptr && mode_ == JournalMode::MODE_WAL) {
         sqlite3_db_release_memory(db);
     }
+    if (stmtCache_ != nullptr && db == dbHandle_ && !isFromReplica) {
+        auto type = SqliteUtils::GetSqlStatementType(sql);
+        if (type == SqliteUtils::STATEMENT_DDL || type == SqliteUtils::STATEMENT_ATTACH ||
+            type == SqliteUtils::STATEMENT_DETACH) {
+            stmtCache_->Clear();
+        } else {
+            statement->cache_ = stmtCache_;
+        }
+    }
     int errCode = statement->Prepare(db, sql + returningSql);
     if (errCode != E_OK) {
         return { errCode, nullptr };
@@ -640,6 +665,11 @@ std::pair<int, std::shared_ptr<Statement>> SqliteConnection::CreateStatementInne
     statement->conn_ = conn;
     if (!isFromReplica && slaveConnection_ && IsWriter() && !IsSupportBinlog(config_) &&
         !SqliteUtils::IsSlaveRestoring(config_.GetPath())) {
+        if (recorder_ != nullptr) {
+            statement->recorder_ = recorder_;
+            statement->replicaSql_ = sql;
+            return { E_OK, statement };
+        }
         auto slaveStmt = std::make_shared<SqliteStatement>();
         if (sql == INTEGRITIES[1] && dbHandle_ != nullptr && mode_ == JournalMode::MODE_WAL) {
             sqlite3_db_release_memory(dbHandle_);
@@ -684,6 +714,7 @@ int SqliteConnection::SubscribeTableChanges(const Connection::Notifier &notifier
         LOG_ERROR("RegisterClientObserver error, status:%{public}d", status);
     }
     RegisterDbHook(dbHandle_);
+    walHooked_ = false;
     config_.SetRegisterInfo(RegisterType::CLIENT_OBSERVER, true);
     return status;
 #endif
@@ -1202,6 +1233,62 @@ int SqliteConnection::SetAutoCheckpoint(const RdbStoreConfig &config)
     return errCode;
 }
 
+int SqliteConnection::SetWalHook(const RdbStoreConfig &config)
+{
+    if (!isWriter_ || isSlave_ || isReadOnly_ || config.IsMemoryRdb() ||
+        config.GetJournalMode() != RdbStoreConfig::GetJournalModeValue(JournalMode::MODE_WAL)) {
+        return E_OK;
+    }
+    auto [errCode, pageSize] = ExecuteForValue("PRAGMA page_size");
+    if (errCode != E_OK) {
+        LOG_WARN("get page size failed:%{public}d, check the wal file size instead", errCode);
+        return errCode;
+    }
+    frameSize_ = static_cast<int64_t>(pageSize) + WAL_FRAME_HEADER_SIZE;
+    autoCheckpoint_ = SqliteGlobalConfig::GetWalAutoCheckpoint();
+    walState_ = GetWalState(config.GetPath());
+    std::string walName = sqlite3_filename_wal(sqlite3_db_filename(dbHandle_, "main"));
+    auto walSize = SqliteUtils::GetFileSize(walName);
+    if (walSize > 0 && walSize / frameSize_ > walState_->peakFrames) {
+        walState_->peakFrames = static_cast<int32_t>(walSize / frameSize_);
+    }
+    // the hook replaces the wal_autocheckpoint of sqlite, the checkpoint is decided by TryCheckPoint instead.
+    sqlite3_wal_hook(dbHandle_, &SqliteConnection::OnWalCommit, walState_.get());
+    walHooked_ = true;
+    return E_OK;
+}
+
+std::shared_ptr<SqliteConnection::WalState> SqliteConnection::GetWalState(const std::string &path)
+{
+    std::lock_guard<decltype(walStatesMutex_)> lock(walStatesMutex_);
+    for (auto it = walStates_.begin(); it != walStates_.end();) {
+        it = it->second.expired() ? walStates_.erase(it) : std::next(it);
+    }
+    auto state = walStates_[path].lock();
+    if (state == nullptr) {
+        state = std::make_shared<WalState>();
+        walStates_[path] = state;
+    }
+    return state;
+}
+
+int SqliteConnection::OnWalCommit(void *arg, sqlite3 *db, const char *dbName, int frames)
+{
+    auto state = static_cast<WalState *>(arg);
+    if (state == nullptr || dbName == nullptr || strcmp(dbName, "main") != 0) {
+        return SQLITE_OK;
+    }
+    // the log has been restarted by the writer, the frames before are checkpointed.
+    if (frames < state->frames) {
+        state->ckptFrames = 0;
+    }
+    state->frames = frames;
+    if (frames > state->peakFrames) {
+        state->peakFrames = frames;
+    }
+    return SQLITE_OK;
+}
+
 int SqliteConnection::SetTokenizer(const RdbStoreConfig &config)
 {
     auto tokenizer = config.GetTokenizer();
@@ -1290,6 +1377,9 @@ int SqliteConnection::ClearCache(bool isForceClear)
             return usedBytes;
         };
         if (isForceClear || getUsedBytes() > config_.GetClearMemorySize()) {
+            if (stmtCache_ != nullptr) {
+                stmtCache_->Clear();
+            }
             sqlite3_db_release_memory(dbHandle_);
         }
     }
@@ -1364,20 +1454,22 @@ int SqliteConnection::TryCheckPoint(bool timeout)
         return E_NOT_SUPPORT;
     }
 
-    std::shared_ptr<Connection> autoCheck(slaveConnection_.get(), [this, timeout](Connection *conn) {
-        if (conn != nullptr && backupId_ == TaskExecutor::INVALID_TASK_ID) {
-            int rc = conn->TryCheckPoint(timeout);
-            if (rc == E_SQLITE_CORRUPT) {
-                RdbStoreConfig slaveConfig(slaveConnection_->config_.GetPath());
-                DeleteCorruptSlave(slaveConfig.GetPath());
-                Reportor::ReportCorrupted(
-                    Reportor::Create(slaveConfig, SQLiteError::ErrNo(rc), "ErrorType: slaveCheckPoint"));
-                LOG_ERROR("slave CheckPoint failed err:%{public}d, errno:%{public}d", rc, errno);
-            }
+    ssize_t size = 0;
+    if (walHooked_) {
+        if (GetCheckPointMode(size) == CHECKPOINT_NONE) {
+            return E_OK;
         }
-    });
+        // the checkpoint is deferred to IdleCheckPoint until the wal is too large to wait.
+        if (size < config_.GetCheckpointSize()) {
+            return E_INNER_WARNING;
+        }
+        auto autoCheck = AutoCheckSlave(timeout);
+        return CheckPoint(SQLITE_CHECKPOINT_TRUNCATE, size);
+    }
+
+    auto autoCheck = AutoCheckSlave(timeout);
     std::string walName = sqlite3_filename_wal(sqlite3_db_filename(dbHandle_, "main"));
-    ssize_t size = SqliteUtils::GetFileSize(walName);
+    size = SqliteUtils::GetFileSize(walName);
     if (size < 0) {
         LOG_ERROR("Invalid size for WAL:%{public}s size:%{public}zd", SqliteUtils::Anonymous(walName).c_str(), size);
         return E_ERROR;
@@ -1390,25 +1482,103 @@ int SqliteConnection::TryCheckPoint(bool timeout)
     if (!timeout && size < config_.GetCheckpointSize()) {
         return E_INNER_WARNING;
     }
+    return CheckPoint(SQLITE_CHECKPOINT_TRUNCATE, size);
+}
+
+int32_t SqliteConnection::IdleCheckPoint()
+{
+    if (!isWriter_ || !walHooked_) {
+        return E_NOT_SUPPORT;
+    }
+    auto autoCheck = AutoCheckSlave(true);
+    ssize_t size = 0;
+    auto mode = GetCheckPointMode(size);
+    if (mode == CHECKPOINT_NONE) {
+        return E_OK;
+    }
+    return CheckPoint(mode, size);
+}
+
+int32_t SqliteConnection::SetReplicator(std::shared_ptr<SlaveReplicator> replicator)
+{
+    // the binlog replays the writes asynchronously already.
+    if (replicator == nullptr || !isWriter_ || slaveConnection_ == nullptr || IsSupportBinlog(config_)) {
+        return E_NOT_SUPPORT;
+    }
+    replicator->Attach(slaveConnection_);
+    recorder_ = std::make_shared<SlaveReplicator::Recorder>(replicator);
+    replicator_ = std::move(replicator);
+    return E_OK;
+}
 
+int SqliteConnection::GetCheckPointMode(ssize_t &size) const
+{
+    int32_t frames = walState_->frames;
+    // the wal file keeps the largest size the log has reached until it is truncated.
+    size = static_cast<ssize_t>(std::max<int32_t>(walState_->peakFrames, frames)) * frameSize_;
+    auto startSize = config_.GetStartCheckpointSize();
+    if (size > startSize) {
+        return SQLITE_CHECKPOINT_TRUNCATE;
+    }
+    // rewinding the log at half of the start size keeps the file below it without truncating.
+    if (static_cast<ssize_t>(frames) * frameSize_ > (startSize >> 1)) {
+        return SQLITE_CHECKPOINT_RESTART;
+    }
+    return frames - walState_->ckptFrames >= autoCheckpoint_ ? SQLITE_CHECKPOINT_PASSIVE : CHECKPOINT_NONE;
+}
+
+int SqliteConnection::CheckPoint(int mode, ssize_t size)
+{
+    int logFrames = -1;
+    int ckptFrames = -1;
     (void)sqlite3_busy_timeout(dbHandle_, isSlave_ && isSupportBinlog_ ? 0 : CHECKPOINT_TIME);
-    int errCode = sqlite3_wal_checkpoint_v2(dbHandle_, nullptr, SQLITE_CHECKPOINT_TRUNCATE, nullptr, nullptr);
+    int errCode = sqlite3_wal_checkpoint_v2(dbHandle_, nullptr, mode, &logFrames, &ckptFrames);
     (void)sqlite3_busy_timeout(dbHandle_, DEFAULT_BUSY_TIMEOUT_MS);
+    if (walState_ != nullptr && logFrames >= 0 && ckptFrames >= 0) {
+        // the log restarts from the beginning on the next write after a complete RESTART or TRUNCATE.
+        bool isRewound = errCode == SQLITE_OK && mode != SQLITE_CHECKPOINT_PASSIVE;
+        walState_->frames = isRewound ? 0 : logFrames;
+        walState_->ckptFrames = isRewound ? 0 : ckptFrames;
+        if (isRewound && mode == SQLITE_CHECKPOINT_TRUNCATE) {
+            walState_->peakFrames = 0;
+        }
+    }
     if (errCode != SQLITE_OK) {
+        std::string walName = sqlite3_filename_wal(sqlite3_db_filename(dbHandle_, "main"));
         Reportor::ReportFault(RdbFaultDbFileEvent(RdbFaultType::FT_CP, E_CHECK_POINT_FAIL, config_,
             "LOG:cp fail, errcode=" + std::to_string(errCode), true));
-        LOG_WARN("sqlite3_wal_checkpoint_v2 failed err:%{public}d,size:%{public}zd,wal:%{public}s.", errCode, size,
-            SqliteUtils::Anonymous(walName).c_str());
+        LOG_WARN("sqlite3_wal_checkpoint_v2 failed err:%{public}d,mode:%{public}d,size:%{public}zd,wal:%{public}s.",
+            errCode, mode, size, SqliteUtils::Anonymous(walName).c_str());
         return SQLiteError::ErrNo(errCode);
     }
     return E_OK;
 }
 
+std::shared_ptr<Connection> SqliteConnection::AutoCheckSlave(bool timeout)
+{
+    return std::shared_ptr<Connection>(slaveConnection_.get(), [this, timeout](Connection *conn) {
+        if (conn != nullptr && backupId_ == TaskExecutor::INVALID_TASK_ID) {
+            int rc = conn->TryCheckPoint(timeout);
+            if (rc == E_SQLITE_CORRUPT) {
+                RdbStoreConfig slaveConfig(slaveConnection_->config_.GetPath());
+                DeleteCorruptSlave(slaveConfig.GetPath());
+                Reportor::ReportCorrupted(
+                    Reportor::Create(slaveConfig, SQLiteError::ErrNo(rc), "ErrorType: slaveCheckPoint"));
+                LOG_ERROR("slave CheckPoint failed err:%{public}d, errno:%{public}d", rc, errno);
+            }
+        }
+    });
+}
+
 int SqliteConnection::LimitWalSize()
 {
     if (!isConfigured_ || !isWriter_ || config_.IsMemoryRdb()) {
         return E_OK;
     }
+    // the file is checked only when the frames in the log get close to the limit.
+    if (walHooked_ && static_cast<ssize_t>(walState_->peakFrames) * frameSize_ <= config_.GetWalLimitSize()) {
+        return E_OK;
+    }
 
     std::string walName = sqlite3_filename_wal(sqlite3_db_filename(dbHandle_, "main"));
     ssize_t fileSize = SqliteUtils::GetFileSize(walName);
@@ -1433,6 +1603,7 @@ int32_t SqliteConnection::Subscribe(const std::shared_ptr<DistributedDB::StoreOb
         return errCode;
     }
     RegisterDbHook(dbHandle_);
+    walHooked_ = false;
     config_.SetRegisterInfo(RegisterType::STORE_OBSERVER, true);
     return E_OK;
 }
@@ -1481,6 +1652,7 @@ int32_t SqliteConnection::Backup(const std::string &databasePath, const std::vec
             if (err != E_OK) {
                 return;
             }
+            conn->replicator_ = replicator_;
             err = conn->ExchangeSlaverToMaster(false, true, slaveStatus);
             if (err != E_OK) {
                 LOG_WARN("master backup to slave failed:%{public}d", err);
@@ -1495,6 +1667,9 @@ int32_t SqliteConnection::Restore(
     const std::string &databasePath, const std::vector<uint8_t> &destEncryptKey,
     std::shared_ptr<SlaveStatus> slaveStatus, const bool isForceRestore)
 {
+    if (stmtCache_ != nullptr) {
+        stmtCache_->Clear();
+    }
     return ExchangeSlaverToMaster(true, true, slaveStatus, isForceRestore);
 };
 
@@ -1586,6 +1761,15 @@ int SqliteConnection::ExchangeSlaverToMaster(bool isRestore, bool verifyDb, std:
 {
     bool isNeedSetAcl = SqliteUtils::HasAccessAcl(config_.GetPath(), SERVICE_GID) ||
                         SqliteUtils::HasAccessAcl(SqliteUtils::GetSlavePath(config_.GetPath()), SERVICE_GID);
+    auto replicator = replicator_;
+    if (replicator != nullptr) {
+        replicator->Suspend();
+    }
+    std::shared_ptr<const char> autoResume("autoResume", [replicator](const char *) {
+        if (replicator != nullptr) {
+            replicator->Resume();
+        }
+    });
     *curStatus = SlaveStatus::BACKING_UP;
     int err = verifyDb ? ExchangeVerify(isRestore, isForceRestore) : E_OK;
     if (err != E_OK) {
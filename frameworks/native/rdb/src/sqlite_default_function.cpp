@@ -18,6 +18,8 @@
 
 #include <sys/stat.h>
 
+#include <cmath>
+#include <cstring>
 #include <vector>
 
 #include "logger.h"
@@ -25,6 +27,7 @@
 #include "sqlite_connection.h"
 #include "sqlite_errno.h"
 #include "sqlite_utils.h"
+#include "vector_distance.h"
 
 #if !defined(CROSS_PLATFORM)
 #include "relational/relational_store_sqlite_ext.h"
@@ -223,6 +226,108 @@ void SqliteFunctionRegistry::ImportDB(sqlite3_context *ctx, int argc, sqlite3_va
     sqlite3_result_null(ctx);
 }
 
+void SqliteFunctionRegistry::L2Distance(sqlite3_context *ctx, int argc, sqlite3_value **argv)
+{
+    VectorArgs args;
+    if (!GetVectors(ctx, argc, argv, args)) {
+        return;
+    }
+    float sum = VectorDistance::L2Square(args.lhs.data, args.rhs.data, args.lhs.size);
+    sqlite3_result_double(ctx, std::sqrt(static_cast<double>(sum)));
+}
+
+void SqliteFunctionRegistry::InnerProduct(sqlite3_context *ctx, int argc, sqlite3_value **argv)
+{
+    VectorArgs args;
+    if (!GetVectors(ctx, argc, argv, args)) {
+        return;
+    }
+    sqlite3_result_double(ctx, VectorDistance::Dot(args.lhs.data, args.rhs.data, args.lhs.size));
+}
+
+void SqliteFunctionRegistry::CosineDistance(sqlite3_context *ctx, int argc, sqlite3_value **argv)
+{
+    VectorArgs args;
+    if (!GetVectors(ctx, argc, argv, args)) {
+        return;
+    }
+    float sums[3];
+    VectorDistance::Cosine(args.lhs.data, args.rhs.data, args.lhs.size, sums);
+    // the direction of a zero vector is undefined.
+    if (sums[1] == 0 || sums[2] == 0) {
+        sqlite3_result_null(ctx);
+        return;
+    }
+    double similarity = sums[0] / (std::sqrt(static_cast<double>(sums[1])) * std::sqrt(static_cast<double>(sums[2])));
+    sqlite3_result_double(ctx, 1.0 - similarity);
+}
+
+/**
+ * Gets the vectors of the two arguments, the result is set to null if either is null and to an error if either
+ * is not a vector or their dimensions differ.
+ */
+bool SqliteFunctionRegistry::GetVectors(sqlite3_context *ctx, int argc, sqlite3_value **argv, VectorArgs &args)
+{
+    // 2 is the number of parameters
+    if (ctx == nullptr || argc != 2 || argv == nullptr) {
+        LOG_ERROR("Parameter does not meet restrictions. ctx: %{public}d, argc: %{public}d, argv: %{public}d",
+            ctx == nullptr, argc, argv == nullptr);
+        SqliteResultError(ctx, SQLITE_ERROR, "invalid param");
+        return false;
+    }
+    if (sqlite3_value_type(argv[0]) == SQLITE_NULL || sqlite3_value_type(argv[1]) == SQLITE_NULL) {
+        sqlite3_result_null(ctx);
+        return false;
+    }
+    if (!GetVector(argv[0], args.buffers[0], args.lhs) || !GetVector(argv[1], args.buffers[1], args.rhs)) {
+        SqliteResultError(ctx, SQLITE_MISMATCH, "not a float vector");
+        return false;
+    }
+    if (args.lhs.size != args.rhs.size) {
+        SqliteResultError(ctx, SQLITE_MISMATCH, "vector dimensions differ");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Gets the floats of the blob in the raw data format of the float vector or as the plain floats. The blob is
+ * read in place unless the floats are unaligned, then they are copied to the buffer.
+ */
+bool SqliteFunctionRegistry::GetVector(sqlite3_value *value, std::vector<float> &buffer, Float32View &view)
+{
+    if (sqlite3_value_type(value) != SQLITE_BLOB) {
+        return false;
+    }
+    auto data = static_cast<const uint8_t *>(sqlite3_value_blob(value));
+    int len = sqlite3_value_bytes(value);
+    if (data == nullptr || len <= 0) {
+        return false;
+    }
+    const uint8_t *values = nullptr;
+    uint32_t count = 0;
+    auto used = RawDataParser::ParserRawData(data, len, values, count);
+    // the plain floats may begin with the same bits as the magic, so the raw data must take the whole blob.
+    if (used != static_cast<size_t>(len)) {
+        if (len % sizeof(float) != 0) {
+            return false;
+        }
+        values = data;
+        count = static_cast<uint32_t>(len / sizeof(float));
+    }
+    if (count == 0) {
+        return false;
+    }
+    if ((reinterpret_cast<uintptr_t>(values) & (alignof(float) - 1)) != 0) {
+        buffer.resize(count);
+        std::memcpy(buffer.data(), values, count * sizeof(float));
+        view = { buffer.data(), buffer.size() };
+        return true;
+    }
+    view = { reinterpret_cast<const float *>(values), count };
+    return true;
+}
+
 int32_t SqliteFunctionRegistry::IntegrityCheck(sqlite3 *dbHandle)
 {
     int32_t errCode = SQLITE_OK;
@@ -17,6 +17,7 @@
 
 #include <rdb_errno.h>
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
 #include <memory>
@@ -28,10 +29,12 @@
 #include "rdb_sql_utils.h"
 #include "result_set.h"
 #include "share_block.h"
+#include "shared_block_pool.h"
 #include "sqlite_connection.h"
 #include "sqlite_errno.h"
 #include "sqlite_statement.h"
 #include "sqlite_utils.h"
+#include "task_executor.h"
 
 namespace OHOS {
 namespace NativeRdb {
@@ -39,9 +42,34 @@ using namespace OHOS::Rdb;
 using namespace std::chrono;
 constexpr int64_t TIME_OUT = 1500;
 
-SqliteSharedResultSet::SqliteSharedResultSet(
-    Time start, Conn conn, std::string sql, const Values &args, const std::string &path)
-    : AbsSharedResultSet(path), conn_(std::move(conn)), qrySql_(std::move(sql)), bindArgs_(args)
+static int32_t StepIntoBlock(const Statement &statement, AppDataFwk::SharedBlock *block, SharedBlockInfo &blockInfo)
+{
+    auto code = block->Clear();
+    if (code != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+        LOG_ERROR("Clear %{public}d.", code);
+        return E_ERROR;
+    }
+    blockInfo.columnNum = statement.GetColumnCount();
+    code = block->SetColumnNum(blockInfo.columnNum);
+    if (code != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+        LOG_ERROR("SetColumnNum %{public}d.", code);
+        return E_ERROR;
+    }
+    auto errCode = statement.FillBlockInfo(&blockInfo);
+    if (errCode != E_OK) {
+        LOG_ERROR("Fill shared block failed, ret is %{public}d", errCode);
+        return errCode;
+    }
+    block->SetStartPos(blockInfo.startPos);
+    block->SetBlockPos(blockInfo.requiredPos - blockInfo.startPos);
+    block->SetLastPos(blockInfo.startPos + block->GetRowNum());
+    return E_OK;
+}
+
+SqliteSharedResultSet::SqliteSharedResultSet(Time start, Conn conn, std::string sql, const Values &args,
+    const std::string &path, const QueryOptions &options)
+    : AbsSharedResultSet(path), isLazyCount_(!options.preCount), isPrefetch_(options.isPrefetch),
+      blockCacheBudget_(options.blockCacheBudget), conn_(std::move(conn)), qrySql_(std::move(sql)), bindArgs_(args)
 {
     if (conn_ == nullptr) {
         isClosed_ = true;
@@ -56,7 +84,9 @@ SqliteSharedResultSet::SqliteSharedResultSet(
     }
     statement_ = statement;
     auto countBegin = steady_clock::now();
-    std::tie(lastErr_, rowCount_) = statement->Count();
+    if (!isLazyCount_) {
+        std::tie(lastErr_, rowCount_) = statement->Count();
+    }
     auto endTime = steady_clock::now();
     int64_t totalCost = duration_cast<milliseconds>(endTime - start).count();
     if (totalCost >= TIME_OUT) {
@@ -128,6 +158,7 @@ std::pair<int, std::vector<std::string>> SqliteSharedResultSet::GetColumnNames()
         return { errCode, {} };
     }
 
+    WaitPrefetch();
     // Get the total number of columns
     auto columnCount = statement->GetColumnCount();
     std::vector<std::string> colNames;
@@ -144,6 +175,16 @@ std::pair<int, std::vector<std::string>> SqliteSharedResultSet::GetColumnNames()
 
 int SqliteSharedResultSet::Close()
 {
+    // The statement and the connection are released after the running fill.
+    WaitPrefetch();
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        prefetch_ = nullptr;
+        spareBlock_ = nullptr;
+        cachedBlocks_.clear();
+        cacheStats_.blocks = 0;
+        cacheStats_.bytes = 0;
+    }
     AbsSharedResultSet::Close();
     statement_ = nullptr;
     conn_ = nullptr;
@@ -153,6 +194,59 @@ int SqliteSharedResultSet::Close()
     return E_OK;
 }
 
+int SqliteSharedResultSet::GetRowCount(int &count)
+{
+    if (isLazyCount_ && rowCount_ == NO_COUNT && !isClosed_ && lastErr_ == E_OK) {
+        auto [statement, errCode] = PrepareStep();
+        if (statement == nullptr) {
+            count = NO_COUNT;
+            return errCode;
+        }
+        WaitPrefetch();
+        std::lock_guard<decltype(globalMtx_)> lockGuard(globalMtx_);
+        if (rowCount_ == NO_COUNT) {
+            std::tie(lastErr_, rowCount_) = statement->Count();
+        }
+    }
+    return AbsSharedResultSet::GetRowCount(count);
+}
+
+/**
+ * Without the row count, the required row is filled first and the end of the result is found by the fill.
+ */
+int SqliteSharedResultSet::GoToRow(int position)
+{
+    if (!isLazyCount_ || rowCount_ != NO_COUNT || isClosed_ || lastErr_ != E_OK) {
+        return AbsSharedResultSet::GoToRow(position);
+    }
+
+    if (position < 0) {
+        SetLastErrorMsg(BuildRowRangeCtx());
+        return E_ROW_OUT_RANGE;
+    }
+
+    if (position == rowPos_) {
+        return E_OK;
+    }
+
+    if (GetBlock() == nullptr) {
+        return E_ERROR;
+    }
+    auto errCode = OnGo(rowPos_, position);
+    // OnGo may have put the prefetched block in place.
+    auto block = GetBlock();
+    if (errCode == E_OK && block != nullptr) {
+        block->SetBlockPos(position - block->GetStartPos());
+        rowPos_ = position;
+        return E_OK;
+    }
+    if (rowCount_ != NO_COUNT && position >= rowCount_) {
+        rowPos_ = rowCount_ != 0 ? rowCount_ : rowPos_;
+        return E_ROW_OUT_RANGE;
+    }
+    return errCode == E_NO_MORE_ROWS ? E_ROW_OUT_RANGE : errCode;
+}
+
 int SqliteSharedResultSet::OnGo(int oldPosition, int newPosition)
 {
     if (isClosed_) {
@@ -167,10 +261,31 @@ int SqliteSharedResultSet::OnGo(int oldPosition, int newPosition)
 
     if ((uint32_t)newPosition < sharedBlock->GetStartPos() || (uint32_t)newPosition >= sharedBlock->GetLastPos() ||
         oldPosition == rowCount_) {
+        if (TakePrefetch(newPosition) || TakeCachedBlock(newPosition)) {
+            return E_OK;
+        }
+        if (blockCacheBudget_ > 0) {
+            {
+                std::lock_guard<decltype(mutex_)> lock(mutex_);
+                cacheStats_.misses++;
+            }
+            // The rows of the current block are kept in the cache, the required rows are filled into another block.
+            auto block = sharedBlock->GetStartPos() < sharedBlock->GetLastPos() ? AcquireFreeBlock(*sharedBlock)
+                                                                                 : nullptr;
+            if (block != nullptr) {
+                SwitchBlock(std::move(block));
+                sharedBlock = GetBlock();
+                if (sharedBlock == nullptr) {
+                    return E_ERROR;
+                }
+            }
+        }
         auto errCode = FillBlock(newPosition);
         if (errCode == E_NO_MORE_ROWS && rowCount_ != Statement::INVALID_COUNT) {
-            rowCount_ = sharedBlock->GetLastPos() > INT_MAX ? Statement::INVALID_COUNT
-                                                            : static_cast<int>(sharedBlock->GetLastPos());
+            auto lastPos = sharedBlock->GetLastPos() > INT_MAX ? Statement::INVALID_COUNT
+                                                               : static_cast<int>(sharedBlock->GetLastPos());
+            // A lazy fill beyond the end starts at the required position, so the last pos may exceed the count.
+            rowCount_ = (isLazyCount_ && lastPos != Statement::INVALID_COUNT) ? std::min(rowCount_, lastPos) : lastPos;
             rowPos_ = rowPos_ > rowCount_ ? rowCount_ : rowPos_;
             SetLastErrorMsg(BuildRowRangeCtx());
             errCode = E_ROW_OUT_RANGE;
@@ -204,6 +319,7 @@ int SqliteSharedResultSet::FillBlock(int requiredPos)
         return errCode;
     }
     blockCapacity_ = block->GetRowNum();
+    SchedulePrefetch(block);
     if ((block->GetStartPos() == block->GetLastPos() && (uint32_t)rowCount_ != block->GetStartPos()) ||
         ((uint32_t)requiredPos < block->GetStartPos() || block->GetLastPos() <= (uint32_t)requiredPos) ||
         block->GetStartPos() > 0) {
@@ -244,33 +360,245 @@ int32_t SqliteSharedResultSet::ExecuteForSharedBlock(AppDataFwk::SharedBlock *bl
         return errCode;
     }
 
-    auto code = block->Clear();
-    if (code != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
-        LOG_ERROR("Clear %{public}d.", code);
-        return E_ERROR;
-    }
-
     SharedBlockInfo blockInfo(block);
     blockInfo.requiredPos = required;
-    blockInfo.columnNum = statement->GetColumnCount();
     blockInfo.isCountAllRows = false;
     blockInfo.startPos = start;
-    code = block->SetColumnNum(blockInfo.columnNum);
-    if (code != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
-        LOG_ERROR("SetColumnNum %{public}d.", code);
-        return E_ERROR;
-    }
     std::lock_guard<decltype(globalMtx_)> lockGuard(globalMtx_);
-    errCode = statement->FillBlockInfo(&blockInfo);
+    errCode = StepIntoBlock(*statement, block, blockInfo);
     if (errCode != E_OK) {
-        LOG_ERROR("Fill shared block failed, ret is %{public}d", errCode);
         return errCode;
     }
-
-    block->SetStartPos(blockInfo.startPos);
-    block->SetBlockPos(required - blockInfo.startPos);
-    block->SetLastPos(blockInfo.startPos + block->GetRowNum());
+    // The block is not full only when the statement has stepped to the end, so the total rows are exact.
+    if (isLazyCount_ && rowCount_ == NO_COUNT && !blockInfo.isFull) {
+        rowCount_ = blockInfo.totalRows;
+    }
     return E_OK;
 }
+
+/**
+ * Fills the block after the current one on the task executor while the consumer reads the current one. The task
+ * holds the statement and the connection until the fill is over, so they are not reused in the meantime.
+ */
+void SqliteSharedResultSet::SchedulePrefetch(const std::shared_ptr<AppDataFwk::SharedBlock> &block)
+{
+    if (!isPrefetch_ || isClosed_ || block->GetStartPos() == block->GetLastPos() ||
+        (rowCount_ != NO_COUNT && block->GetLastPos() >= static_cast<uint32_t>(rowCount_))) {
+        return;
+    }
+    auto statement = statement_;
+    auto conn = conn_;
+    auto executor = TaskExecutor::GetInstance().GetExecutor();
+    if (statement == nullptr || conn == nullptr || executor == nullptr) {
+        return;
+    }
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    if (prefetch_ != nullptr) {
+        return;
+    }
+    if (spareBlock_ == nullptr) {
+        auto &pool = SharedBlockPool::GetInstance();
+        if (pool.GetStats().usingBytes + block->Size() > MAX_PREFETCH_BYTES) {
+            return;
+        }
+        auto [code, spare] = pool.Acquire(block->Name(), block->Size());
+        if (code != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+            return;
+        }
+        spareBlock_ = std::move(spare);
+    }
+    auto task = std::make_shared<PrefetchTask>();
+    task->block = std::move(spareBlock_);
+    int start = static_cast<int>(block->GetLastPos());
+    executor->Execute([task, statement, conn, start]() {
+        {
+            std::lock_guard<decltype(task->mutex)> lock(task->mutex);
+            if (task->status == PrefetchTask::CANCELED) {
+                return;
+            }
+            task->status = PrefetchTask::RUNNING;
+        }
+        SharedBlockInfo blockInfo(task->block.get());
+        blockInfo.requiredPos = start;
+        blockInfo.isCountAllRows = false;
+        blockInfo.startPos = start;
+        auto errCode = StepIntoBlock(*statement, task->block.get(), blockInfo);
+        std::lock_guard<decltype(task->mutex)> lock(task->mutex);
+        task->errCode = errCode;
+        task->isFull = blockInfo.isFull;
+        task->totalRows = blockInfo.totalRows;
+        task->status = PrefetchTask::DONE;
+        task->cond.notify_all();
+    });
+    prefetch_ = std::move(task);
+}
+
+/**
+ * Makes the statement free for the consumer, the fill not started yet is canceled and the running one is waited.
+ */
+void SqliteSharedResultSet::WaitPrefetch()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    if (prefetch_ == nullptr) {
+        return;
+    }
+    std::unique_lock<decltype(prefetch_->mutex)> taskLock(prefetch_->mutex);
+    if (prefetch_->status == PrefetchTask::PENDING) {
+        prefetch_->status = PrefetchTask::CANCELED;
+        spareBlock_ = std::move(prefetch_->block);
+        taskLock.unlock();
+        prefetch_ = nullptr;
+        return;
+    }
+    auto &task = prefetch_;
+    task->cond.wait(taskLock, [&task]() { return task->status == PrefetchTask::DONE; });
+}
+
+/**
+ * Puts the prefetched block in place if it holds the required row, otherwise the caller fills the block itself.
+ */
+bool SqliteSharedResultSet::TakePrefetch(int requiredPos)
+{
+    WaitPrefetch();
+    std::shared_ptr<PrefetchTask> task;
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        task = std::move(prefetch_);
+    }
+    if (task == nullptr) {
+        return false;
+    }
+    auto block = std::move(task->block);
+    if (task->errCode != E_OK || static_cast<uint32_t>(requiredPos) < block->GetStartPos() ||
+        static_cast<uint32_t>(requiredPos) >= block->GetLastPos()) {
+        RecycleBlock(std::move(block), task->errCode == E_OK);
+        return false;
+    }
+    // The block is not full only when the statement has stepped to the end, so the total rows are exact.
+    if (isLazyCount_ && rowCount_ == NO_COUNT && !task->isFull) {
+        rowCount_ = task->totalRows;
+    }
+    block->SetBlockPos(requiredPos - block->GetStartPos());
+    SwitchBlock(std::move(block));
+    auto current = GetBlock();
+    if (current == nullptr) {
+        return false;
+    }
+    blockCapacity_ = current->GetRowNum();
+    SchedulePrefetch(current);
+    return true;
+}
+
+/**
+ * Serves the required row from the recently visited blocks without re-running the query.
+ */
+bool SqliteSharedResultSet::TakeCachedBlock(int requiredPos)
+{
+    if (blockCacheBudget_ == 0) {
+        return false;
+    }
+    std::shared_ptr<AppDataFwk::SharedBlock> block;
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        auto pos = static_cast<uint32_t>(requiredPos);
+        auto it = std::find_if(cachedBlocks_.begin(), cachedBlocks_.end(), [pos](const auto &cached) {
+            return cached->GetStartPos() <= pos && pos < cached->GetLastPos();
+        });
+        if (it == cachedBlocks_.end()) {
+            return false;
+        }
+        block = std::move(*it);
+        cachedBlocks_.erase(it);
+        cacheStats_.blocks--;
+        cacheStats_.bytes -= block->Size();
+        cacheStats_.hits++;
+    }
+    block->SetBlockPos(requiredPos - block->GetStartPos());
+    SwitchBlock(std::move(block));
+    auto current = GetBlock();
+    if (current == nullptr) {
+        return false;
+    }
+    blockCapacity_ = current->GetRowNum();
+    return true;
+}
+
+/**
+ * Puts the block in place of the current one, the rows of the current one go to the cache. The block handed out
+ * keeps its place, so its rows are copied out before they are overwritten.
+ */
+void SqliteSharedResultSet::SwitchBlock(std::shared_ptr<AppDataFwk::SharedBlock> block)
+{
+    auto current = GetBlock();
+    if (current == nullptr) {
+        RecycleBlock(std::move(block), true);
+        return;
+    }
+    bool isShared = current->IsShared();
+    std::shared_ptr<AppDataFwk::SharedBlock> copy;
+    if (isShared && blockCacheBudget_ > 0 && current->GetStartPos() < current->GetLastPos()) {
+        copy = AcquireFreeBlock(*current);
+        if (copy != nullptr && copy->SetRawData(current->GetHeader(), current->GetUsedBytes()) !=
+            AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+            copy = nullptr;
+        }
+    }
+    // The block returned by the exchange is the previous current one, or a copy of the new one if it is shared.
+    RecycleBlock(ExchangeBlock(std::move(block)), !isShared);
+    RecycleBlock(std::move(copy), true);
+}
+
+/**
+ * Obtains a block to fill, the spare one first, then the least recently used one when the cache is full.
+ */
+std::shared_ptr<AppDataFwk::SharedBlock> SqliteSharedResultSet::AcquireFreeBlock(AppDataFwk::SharedBlock &current)
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        if (spareBlock_ != nullptr) {
+            return std::move(spareBlock_);
+        }
+        if (!cachedBlocks_.empty() && cacheStats_.bytes + current.Size() > blockCacheBudget_) {
+            auto block = std::move(cachedBlocks_.back());
+            cachedBlocks_.pop_back();
+            cacheStats_.blocks--;
+            cacheStats_.bytes -= block->Size();
+            return block;
+        }
+    }
+    auto [code, block] = SharedBlockPool::GetInstance().Acquire(current.Name(), current.Size());
+    return code == AppDataFwk::SharedBlock::SHARED_BLOCK_OK ? block : nullptr;
+}
+
+/**
+ * Keeps the filled block in the cache within the budget, the block out of the cache is kept as the spare one.
+ */
+void SqliteSharedResultSet::RecycleBlock(std::shared_ptr<AppDataFwk::SharedBlock> block, bool isCache)
+{
+    if (block == nullptr) {
+        return;
+    }
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    if (isCache && !isClosed_ && block->GetStartPos() < block->GetLastPos() && block->Size() <= blockCacheBudget_) {
+        cacheStats_.blocks++;
+        cacheStats_.bytes += block->Size();
+        cachedBlocks_.push_front(std::move(block));
+        while (cacheStats_.bytes > blockCacheBudget_) {
+            block = std::move(cachedBlocks_.back());
+            cachedBlocks_.pop_back();
+            cacheStats_.blocks--;
+            cacheStats_.bytes -= block->Size();
+        }
+    }
+    if (block != nullptr && spareBlock_ == nullptr && !isClosed_) {
+        spareBlock_ = std::move(block);
+    }
+}
+
+SqliteSharedResultSet::BlockCacheStats SqliteSharedResultSet::GetBlockCacheStats()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return cacheStats_;
+}
 } // namespace NativeRdb
 } // namespace OHOS
\ No newline at end of file
@@ -254,75 +254,72 @@ std::string SqliteSqlBuilder::GetSqlArgs(size_t size)
     return args;
 }
 
-SqliteSqlBuilder::BatchRefSqls SqliteSqlBuilder::GenerateSqls(
-    const std::string &table, const ValuesBuckets &buckets, int limit, ConflictResolution resolution)
+std::string SqliteSqlBuilder::GetInsertHeader(
+    const std::string &table, const ValuesBuckets::FieldsType &fields, ConflictResolution resolution)
 {
-    auto [fields, values] = buckets.GetFieldsAndValues();
-    auto columnSize = fields->size();
-    auto rowSize = buckets.RowSize();
-    std::vector<std::reference_wrapper<ValueObject>> args(columnSize * rowSize, nullRef_);
     std::string sql = "INSERT" + g_onConflictClause[static_cast<int32_t>(resolution)] + " INTO " + table + " (";
-    size_t columnIndex = 0;
     for (auto &field : *fields) {
-        for (size_t row = 0; row < rowSize; ++row) {
-            auto [errorCode, value] = buckets.Get(row, std::ref(field));
-            if (errorCode != E_OK) {
-                continue;
-            }
-            SqliteSqlBuilder::UpdateAssetStatus(value.get(), AssetValue::STATUS_INSERT);
-            args[columnIndex + row * columnSize] = value;
-        }
-        columnIndex++;
         sql.append(field).append(",");
     }
     sql.pop_back();
     sql.append(") VALUES ");
-    return SqliteSqlBuilder::MakeExecuteSqls(sql, args, columnSize, limit);
+    return sql;
 }
 
-SqliteSqlBuilder::BatchRefSqls SqliteSqlBuilder::MakeExecuteSqls(
-    const std::string &sql, const std::vector<RefValue> &args, int fieldSize, int limit)
+std::string SqliteSqlBuilder::GetBatchSql(const std::string &header, size_t fieldSize, size_t rows)
 {
-    if (fieldSize == 0) {
-        return BatchRefSqls();
+    std::string rowArgs = "(" + SqliteSqlBuilder::GetSqlArgs(fieldSize) + "),";
+    std::string sql;
+    sql.reserve(header.size() + rowArgs.size() * rows);
+    sql.append(header);
+    for (size_t i = 0; i < rows; ++i) {
+        sql.append(rowArgs);
     }
-    size_t rowNumbers = args.size() / static_cast<size_t>(fieldSize);
-    size_t maxRowNumbersOneTimes = static_cast<size_t>(limit / fieldSize);
-    if (maxRowNumbersOneTimes == 0) {
-        return BatchRefSqls();
+    sql.pop_back();
+    return sql;
+}
+
+std::vector<SqliteSqlBuilder::BatchSql> SqliteSqlBuilder::GenerateBatchSqls(
+    const std::string &table, const ValuesBuckets &buckets, int limit, ConflictResolution resolution)
+{
+    auto fields = buckets.GetFields();
+    auto fieldSize = fields->size();
+    if (fieldSize == 0 || limit <= 0) {
+        return {};
     }
-    size_t executeTimes = rowNumbers / maxRowNumbersOneTimes;
-    size_t remainingRows = rowNumbers % maxRowNumbersOneTimes;
-    std::string singleRowSqlArgs = "(" + SqliteSqlBuilder::GetSqlArgs(fieldSize) + ")";
-    auto appendAgsSql = [&singleRowSqlArgs, &sql](size_t rowNumber) {
-        std::string sqlStr = sql;
-        for (size_t i = 0; i < rowNumber; ++i) {
-            sqlStr.append(singleRowSqlArgs).append(",");
-        }
-        sqlStr.pop_back();
-        return sqlStr;
-    };
-    std::string executeSql;
-    BatchRefSqls executeSqls;
-    auto start = args.begin();
-    if (executeTimes != 0) {
-        executeSql = appendAgsSql(maxRowNumbersOneTimes);
-        std::vector<std::vector<RefValue>> sqlArgs;
-        size_t maxVariableNumbers = maxRowNumbersOneTimes * static_cast<size_t>(fieldSize);
-        for (size_t i = 0; i < executeTimes; ++i) {
-            std::vector<RefValue> bindValueArgs(start, start + maxVariableNumbers);
-            sqlArgs.emplace_back(std::move(bindValueArgs));
-            start += maxVariableNumbers;
-        }
-        executeSqls.emplace_back(std::make_pair(executeSql, std::move(sqlArgs)));
+    size_t maxRows = static_cast<size_t>(limit) / fieldSize;
+    if (maxRows == 0) {
+        return {};
+    }
+    auto rowSize = buckets.RowSize();
+    auto header = GetInsertHeader(table, fields, resolution);
+    std::vector<BatchSql> batchSqls;
+    if (rowSize >= maxRows) {
+        batchSqls.push_back({ GetBatchSql(header, fieldSize, maxRows), maxRows, rowSize / maxRows });
+    }
+    if (rowSize % maxRows != 0) {
+        batchSqls.push_back({ GetBatchSql(header, fieldSize, rowSize % maxRows), rowSize % maxRows, 1 });
     }
+    return batchSqls;
+}
 
-    if (remainingRows != 0) {
-        executeSql = appendAgsSql(remainingRows);
-        std::vector<std::vector<RefValue>> sqlArgs(1, std::vector<RefValue>(start, args.end()));
-        executeSqls.emplace_back(std::make_pair(executeSql, std::move(sqlArgs)));
+void SqliteSqlBuilder::FillBatchArgs(
+    const ValuesBuckets &buckets, size_t begin, size_t rows, std::vector<RefValue> &args)
+{
+    auto fields = buckets.GetFields();
+    // reuses the storage of args, the values are bound from the buckets directly.
+    args.assign(fields->size() * rows, nullRef_);
+    size_t index = 0;
+    for (size_t row = begin; row < begin + rows; ++row) {
+        for (auto &field : *fields) {
+            auto [errorCode, value] = buckets.Get(row, std::ref(field));
+            if (errorCode == E_OK) {
+                SqliteSqlBuilder::UpdateAssetStatus(value.get(), AssetValue::STATUS_INSERT);
+                args[index] = value;
+            }
+            index++;
+        }
     }
-    return executeSqls;
 }
 
 void SqliteSqlBuilder::UpdateAssetStatus(const ValueObject &val, int32_t status)
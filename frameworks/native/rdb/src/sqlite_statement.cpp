@@ -15,13 +15,13 @@
 #define LOG_TAG "SqliteStatement"
 #include "sqlite_statement.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <iomanip>
 #include <memory>
 #include <sstream>
 #include <utility>
 
-#include "cache_block.h"
 #include "connection_pool.h"
 #include "corrupted_handle_manager.h"
 #include "logger.h"
@@ -59,6 +59,22 @@ static constexpr const char *ERR_MSG[] = {
     "has no column named"
 };
 
+static std::vector<ValuesBucket> ToBuckets(ReturningRows &&rows)
+{
+    std::vector<ValuesBucket> buckets;
+    auto width = rows.columns.size();
+    if (width == 0) {
+        return buckets;
+    }
+    buckets.resize(rows.values.size() / width);
+    for (size_t row = 0; row < buckets.size(); ++row) {
+        for (size_t col = 0; col < width; ++col) {
+            buckets[row].Put(rows.columns[col], std::move(rows.values[row * width + col]));
+        }
+    }
+    return buckets;
+}
+
 SqliteStatement::SqliteStatement(const RdbStoreConfig *config)
     : readOnly_(false), columnCount_(0), numParameters_(0), stmt_(nullptr), sql_(""), config_(config)
 {
@@ -152,9 +168,16 @@ int SqliteStatement::Prepare(sqlite3 *dbHandle, const std::string &newSql)
     }
     // prepare the new sqlite3_stmt
     sqlite3_stmt *stmt = nullptr;
+    uint64_t generation = 0;
     SqlStatistic sqlStatistic(newSql, SqlStatistic::Step::STEP_PREPARE, seqId_);
     PerfStat perfStat((config_ != nullptr) ? config_->GetPath() : "", newSql, PerfStat::Step::STEP_PREPARE, seqId_);
-    int errCode = sqlite3_prepare_v2(dbHandle, newSql.c_str(), newSql.length(), &stmt, nullptr);
+    if (cache_ != nullptr) {
+        std::tie(stmt, generation) = cache_->Acquire(newSql);
+    }
+    int errCode = SQLITE_OK;
+    if (stmt == nullptr) {
+        errCode = sqlite3_prepare_v2(dbHandle, newSql.c_str(), newSql.length(), &stmt, nullptr);
+    }
     if (errCode != SQLITE_OK) {
         std::string errMsg(sqlite3_errmsg(dbHandle));
         TryNotifyErrorLog(errCode, dbHandle, newSql);
@@ -184,13 +207,30 @@ int SqliteStatement::Prepare(sqlite3 *dbHandle, const std::string &newSql)
     InnerFinalize(); // finalize the old
     sql_ = newSql;
     stmt_ = stmt;
+    generation_ = generation;
     readOnly_ = (sqlite3_stmt_readonly(stmt_) != 0);
     columnCount_ = sqlite3_column_count(stmt_);
+    reprepareCount_ = sqlite3_stmt_status(stmt_, SQLITE_STMTSTATUS_REPREPARE, 0);
     types_ = std::vector<int32_t>(columnCount_, COLUMN_TYPE_INVALID);
     numParameters_ = sqlite3_bind_parameter_count(stmt_);
     return E_OK;
 }
 
+void SqliteStatement::RefreshColumnInfo() const
+{
+    // the cached statement may be re-prepared by sqlite after the schema has been changed by other connections.
+    if (cache_ == nullptr || stmt_ == nullptr) {
+        return;
+    }
+    int reprepareCount = sqlite3_stmt_status(stmt_, SQLITE_STMTSTATUS_REPREPARE, 0);
+    if (reprepareCount == reprepareCount_) {
+        return;
+    }
+    reprepareCount_ = reprepareCount;
+    columnCount_ = sqlite3_column_count(stmt_);
+    types_ = std::vector<int32_t>(columnCount_, COLUMN_TYPE_INVALID);
+}
+
 void SqliteStatement::PrintInfoForDbError(int errCode, const std::string &sql)
 {
     if (config_ == nullptr) {
@@ -238,16 +278,17 @@ void SqliteStatement::ReadFile2Buffer()
     (void)fclose(file);
 }
 
-int SqliteStatement::BindArgs(const std::vector<ValueObject> &bindArgs)
+int SqliteStatement::BindArgs(const std::vector<ValueObject> &bindArgs, bool isStatic)
 {
     std::vector<std::reference_wrapper<ValueObject>> refBindArgs;
+    refBindArgs.reserve(bindArgs.size());
     for (auto &object : bindArgs) {
         refBindArgs.emplace_back(std::ref(const_cast<ValueObject &>(object)));
     }
-    return BindArgs(refBindArgs);
+    return BindArgs(refBindArgs, isStatic);
 }
 
-int SqliteStatement::BindArgs(const std::vector<std::reference_wrapper<ValueObject>> &bindArgs)
+int SqliteStatement::BindArgs(const std::vector<std::reference_wrapper<ValueObject>> &bindArgs, bool isStatic)
 {
     SqlStatistic sqlStatistic("", SqlStatistic::Step::STEP_PREPARE, seqId_);
     PerfStat perfStat((config_ != nullptr) ? config_->GetPath() : "", "", PerfStat::Step::STEP_PREPARE, seqId_);
@@ -267,7 +308,7 @@ int SqliteStatement::BindArgs(const std::vector<std::reference_wrapper<ValueObje
             LOG_ERROR("not support the type %{public}zu", arg.get().value.index());
             return E_INVALID_ARGS;
         }
-        auto errCode = action(stmt_, index, arg.get().value);
+        auto errCode = action(stmt_, index, arg.get().value, isStatic ? SQLITE_STATIC : SQLITE_TRANSIENT);
         if (errCode != SQLITE_OK) {
             LOG_ERROR("Bind has error: %{public}d, sql: %{public}s, errno %{public}d",
                 errCode, SqliteUtils::SqlAnonymous(sql_).c_str(), errno);
@@ -279,6 +320,26 @@ int SqliteStatement::BindArgs(const std::vector<std::reference_wrapper<ValueObje
     return E_OK;
 }
 
+void SqliteStatement::UnbindArgs()
+{
+    // drop the values bound by SQLITE_STATIC before their owner goes away.
+    sqlite3_reset(stmt_);
+    sqlite3_clear_bindings(stmt_);
+    bound_ = false;
+}
+
+SqliteStatement::UnbindGuard::UnbindGuard(SqliteStatement &statement, bool isStatic)
+    : statement_(statement), isStatic_(isStatic)
+{
+}
+
+SqliteStatement::UnbindGuard::~UnbindGuard()
+{
+    if (isStatic_) {
+        statement_.UnbindArgs();
+    }
+}
+
 int SqliteStatement::CheckValueObjectValid(const ValueObject &obj, int paramPos, size_t totalParams) const
 {
     std::string bundleName = (config_ != nullptr) ? config_->GetBundleName() : "";
@@ -330,6 +391,10 @@ int SqliteStatement::Prepare(const std::string &sql)
     if (errCode != E_OK) {
         return errCode;
     }
+    if (recorder_) {
+        replicaSql_ = sql;
+        replicaArgs_.clear();
+    }
 
     if (slave_) {
         int errCode = slave_->Prepare(sql);
@@ -344,22 +409,9 @@ int SqliteStatement::Prepare(const std::string &sql)
 int SqliteStatement::Bind(const std::vector<ValueObject> &args)
 {
     int count = static_cast<int>(args.size());
-    std::vector<ValueObject> abindArgs;
-
     if (count == 0) {
         return E_OK;
     }
-    // Obtains the bound parameter set.
-    if ((numParameters_ != 0) && (count <= numParameters_)) {
-        for (const auto &i : args) {
-            abindArgs.push_back(i);
-        }
-
-        for (int i = count; i < numParameters_; i++) { // TD: when count <> numParameters
-            ValueObject val;
-            abindArgs.push_back(val);
-        }
-    }
 
     if (count > numParameters_) {
         LOG_ERROR("bind args count(%{public}d) > numParameters(%{public}d), sql: %{public}s", count, numParameters_,
@@ -367,10 +419,17 @@ int SqliteStatement::Bind(const std::vector<ValueObject> &args)
         return E_INVALID_BIND_ARGS_COUNT;
     }
 
-    int errCode = BindArgs(abindArgs);
+    // the args are held by the result set as long as the statement, so they are bound without copy.
+    int errCode = BindArgs(args, true);
     if (errCode != E_OK) {
         return errCode;
     }
+    for (int i = count + 1; i <= numParameters_; i++) {
+        sqlite3_bind_null(stmt_, i);
+    }
+    if (recorder_ && !readOnly_) {
+        replicaArgs_ = args;
+    }
 
     if (slave_) {
         int errCode = slave_->Bind(args);
@@ -397,7 +456,17 @@ std::pair<int32_t, int32_t> SqliteStatement::Count()
 
 int SqliteStatement::Step()
 {
+    // only the first step runs the writing statement, the others return its rows.
+    bool isFirst = recorder_ && !readOnly_ && sqlite3_stmt_busy(stmt_) == 0;
     int ret = InnerStep();
+    if (isFirst && (ret == E_OK || ret == E_NO_MORE_ROWS)) {
+        std::vector<std::reference_wrapper<ValueObject>> args;
+        args.reserve(replicaArgs_.size());
+        for (auto &arg : replicaArgs_) {
+            args.emplace_back(std::ref(arg));
+        }
+        Replicate(args);
+    }
     if (ret != E_OK) {
         return ret;
     }
@@ -414,7 +483,19 @@ int SqliteStatement::InnerStep()
 {
     SqlStatistic sqlStatistic("", SqlStatistic::Step::STEP_EXECUTE, seqId_);
     PerfStat perfStat((config_ != nullptr) ? config_->GetPath() : "", "", PerfStat::Step::STEP_EXECUTE, seqId_);
-    auto errCode = sqlite3_step(stmt_);
+    return HandleStepResult(sqlite3_step(stmt_));
+}
+
+void SqliteStatement::Replicate(const std::vector<std::reference_wrapper<ValueObject>> &args)
+{
+    if (recorder_) {
+        recorder_->Append(replicaSql_, args, readOnly_, sqlite3_get_autocommit(sqlite3_db_handle(stmt_)) != 0);
+    }
+}
+
+int SqliteStatement::HandleStepResult(int errCode)
+{
+    RefreshColumnInfo();
     auto db = sqlite3_db_handle(stmt_);
     TryNotifyErrorLog(errCode, db, sql_);
     int ret = SQLiteError::ErrNo(errCode);
@@ -481,7 +562,10 @@ int32_t SqliteStatement::Execute(const std::vector<std::reference_wrapper<ValueO
     if (errCode != E_OK) {
         return errCode;
     }
-    errCode = BindArgs(args);
+    // the statement without result columns is done with the args when it returns, bind them without copy.
+    bool isStatic = columnCount_ == 0 && !args.empty();
+    errCode = BindArgs(args, isStatic);
+    UnbindGuard unbind(*this, isStatic);
     if (errCode != E_OK) {
         return errCode;
     }
@@ -502,6 +586,7 @@ int32_t SqliteStatement::Execute(const std::vector<std::reference_wrapper<ValueO
             SqliteUtils::SetSlaveInvalid(config_->GetPath());
         }
     }
+    Replicate(args);
     return E_OK;
 }
 
@@ -526,22 +611,43 @@ std::pair<int, std::vector<ValuesBucket>> SqliteStatement::ExecuteForRows(
 
 std::pair<int, std::vector<ValuesBucket>> SqliteStatement::ExecuteForRows(
     const std::vector<std::reference_wrapper<ValueObject>> &args, int32_t maxCount)
+{
+    auto [errCode, rows] = ExecuteForReturning(args, maxCount);
+    return { errCode, ToBuckets(std::move(rows)) };
+}
+
+std::pair<int, ReturningRows> SqliteStatement::ExecuteForReturning(
+    const std::vector<ValueObject> &args, int32_t maxCount)
+{
+    std::vector<std::reference_wrapper<ValueObject>> refArgs;
+    refArgs.reserve(args.size());
+    for (auto &object : args) {
+        refArgs.emplace_back(std::ref(const_cast<ValueObject &>(object)));
+    }
+    return ExecuteForReturning(refArgs, maxCount);
+}
+
+std::pair<int, ReturningRows> SqliteStatement::ExecuteForReturning(
+    const std::vector<std::reference_wrapper<ValueObject>> &args, int32_t maxCount)
 {
     if (columnCount_ <= 0) {
         return { Execute(args), {} };
     }
-    std::pair<int, std::vector<ValuesBucket>> ret;
+    std::pair<int, ReturningRows> ret;
     auto &[errCode, rows] = ret;
     errCode = CheckEnvironment(static_cast<int>(args.size()));
     if (errCode != E_OK) {
         return ret;
     }
-    errCode = BindArgs(args);
+    // the rows are copied out before it returns, so the args are bound without copy.
+    bool isStatic = !args.empty();
+    errCode = BindArgs(args, isStatic);
+    UnbindGuard unbind(*this, isStatic);
     if (errCode != E_OK) {
         return ret;
     }
 
-    ret = GetRows(maxCount);
+    ret = StepRows(maxCount);
     if (errCode != E_NO_MORE_ROWS && errCode != E_OK) {
         LOG_ERROR("sqlite3_step failed %{public}d, sql is %{public}s, errno %{public}d", errCode,
             SqliteUtils::SqlAnonymous(sql_).c_str(), errno);
@@ -559,7 +665,9 @@ std::pair<int, std::vector<ValuesBucket>> SqliteStatement::ExecuteForRows(
             SqliteUtils::SetSlaveInvalid(config_->GetPath());
         }
     }
-    return {E_OK, rows};
+    Replicate(args);
+    errCode = E_OK;
+    return ret;
 }
 
 int SqliteStatement::Changes() const
@@ -700,9 +808,20 @@ std::pair<int32_t, ValueObject> SqliteStatement::GetColumn(int index) const
 
 std::pair<int32_t, std::vector<ValuesBucket>> SqliteStatement::GetRows(int32_t maxCount)
 {
+    auto [errCode, rows] = StepRows(maxCount);
+    if (errCode != E_OK) {
+        return { errCode, {} };
+    }
+    return { E_OK, ToBuckets(std::move(rows)) };
+}
+
+std::pair<int32_t, ReturningRows> SqliteStatement::StepRows(int32_t maxCount)
+{
+    std::pair<int32_t, ReturningRows> ret{ E_OK, {} };
+    auto &[errCode, rows] = ret;
     auto colCount = GetColumnCount();
     if (colCount <= 0) {
-        return { E_OK, {} };
+        return ret;
     }
     std::vector<std::string> colNames;
     colNames.reserve(colCount);
@@ -714,20 +833,110 @@ std::pair<int32_t, std::vector<ValuesBucket>> SqliteStatement::GetRows(int32_t m
         }
         colNames.push_back(std::move(colName));
     }
-    AppDataFwk::CacheBlock block(maxCount, colNames);
-    SharedBlockInfo info(&block);
-    info.isCountAllRows = true;
-    info.totalRows = -1;
-    auto res = FillBlockInfo(&info, 0);
-    if (res != E_OK) {
-        LOG_ERROR("FillBlockInfo ret %{public}d", res);
-        return { res, {} };
+    // the values are put to the columns sorted by name as the ValuesBucket, the last one wins for the same name.
+    rows.columns = colNames;
+    std::sort(rows.columns.begin(), rows.columns.end());
+    rows.columns.erase(std::unique(rows.columns.begin(), rows.columns.end()), rows.columns.end());
+    std::vector<size_t> slots(colCount);
+    for (int i = 0; i < colCount; i++) {
+        auto it = std::lower_bound(rows.columns.begin(), rows.columns.end(), colNames[i]);
+        slots[i] = static_cast<size_t>(it - rows.columns.begin());
+    }
+    auto width = rows.columns.size();
+    std::vector<int32_t> blobTypes(colCount, COLUMN_TYPE_INVALID);
+    int32_t rowCount = 0;
+    int32_t valueCode = E_OK;
+    int status = SQLITE_ROW;
+    {
+        SqlStatistic sqlStatistic("", SqlStatistic::Step::STEP_EXECUTE, seqId_);
+        PerfStat perfStat((config_ != nullptr) ? config_->GetPath() : "", "", PerfStat::Step::STEP_EXECUTE, seqId_);
+        // all the rows are stepped even if over maxCount, the changes of the RETURNING statement are made by steps.
+        while ((status = sqlite3_step(stmt_)) == SQLITE_ROW) {
+            if (rowCount >= maxCount || valueCode != E_OK) {
+                continue;
+            }
+            rows.values.resize(rows.values.size() + width);
+            auto *values = &rows.values[rowCount * width];
+            for (int i = 0; i < colCount && valueCode == E_OK; i++) {
+                std::tie(valueCode, values[slots[i]]) = GetRowValue(i, blobTypes);
+            }
+            rowCount++;
+        }
+    }
+    errCode = HandleStepResult(status);
+    sqlite3_reset(stmt_);
+    if (errCode == E_NO_MORE_ROWS) {
+        errCode = valueCode;
+    }
+    if (errCode != E_OK) {
+        LOG_ERROR("StepRows ret %{public}d", errCode);
+        rows.values.clear();
+    }
+    return ret;
+}
+
+std::pair<int32_t, ValueObject> SqliteStatement::GetRowValue(int32_t index, std::vector<int32_t> &blobTypes) const
+{
+    switch (sqlite3_column_type(stmt_, index)) {
+        case SQLITE_INTEGER:
+            return { E_OK, ValueObject(static_cast<int64_t>(sqlite3_column_int64(stmt_, index))) };
+        case SQLITE_FLOAT:
+            return { E_OK, ValueObject(sqlite3_column_double(stmt_, index)) };
+        case SQLITE_TEXT: {
+            auto text = reinterpret_cast<const char *>(sqlite3_column_text(stmt_, index));
+            int size = sqlite3_column_bytes(stmt_, index);
+            return { E_OK, ValueObject(text == nullptr ? std::string("") : std::string(text, size)) };
+        }
+        case SQLITE_BLOB: {
+            // the expression column has no declared type, its blob is kept as the plain blob.
+            if (blobTypes[index] == COLUMN_TYPE_INVALID) {
+                auto decl = sqlite3_column_decltype(stmt_, index);
+                blobTypes[index] = decl == nullptr ? int32_t(ColumnType::TYPE_BLOB) : GetColumnType(index).second;
+            }
+            return GetReturningBlob(index, blobTypes[index]);
+        }
+        default:
+            break;
     }
-    if (block.HasException()) {
-        LOG_ERROR("HasException ret");
-        return { E_ERROR, {} };
+    return { E_OK, ValueObject() };
+}
+
+int32_t SqliteStatement::FetchRow(ColumnBatch &batch) const
+{
+    for (int32_t index = 0; index < static_cast<int32_t>(batch.columns.size()); ++index) {
+        auto errCode = IsValid(index);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        auto &column = batch.columns[index];
+        // the asset, assets, float32 array and bigint are the blobs of their raw data, as in the shared block.
+        int type = sqlite3_column_type(stmt_, index);
+        switch (type) {
+            case SQLITE_NULL:
+                column.PutNull();
+                break;
+            case SQLITE_INTEGER:
+                column.PutLong(static_cast<int64_t>(sqlite3_column_int64(stmt_, index)));
+                break;
+            case SQLITE_FLOAT:
+                column.PutDouble(sqlite3_column_double(stmt_, index));
+                break;
+            case SQLITE_TEXT: {
+                auto text = sqlite3_column_text(stmt_, index);
+                column.PutText(ColumnType::TYPE_STRING, text, sqlite3_column_bytes(stmt_, index));
+                break;
+            }
+            case SQLITE_BLOB: {
+                auto blob = sqlite3_column_blob(stmt_, index);
+                column.PutText(ColumnType::TYPE_BLOB, blob, sqlite3_column_bytes(stmt_, index));
+                break;
+            }
+            default:
+                LOG_ERROR("Invalid type is %{public}d, col is %{public}d!", type, index);
+                return E_INVALID_OBJECT_TYPE;
+        }
     }
-    return { E_OK, block.StealRows() };
+    return E_OK;
 }
 
 ValueObject SqliteStatement::GetValueFromBlob(int32_t index, int32_t type) const
@@ -764,6 +973,51 @@ ValueObject SqliteStatement::GetValueFromBlob(int32_t index, int32_t type) const
     return ValueObject(std::vector<uint8_t>(blob, blob + size));
 }
 
+std::pair<int32_t, ValueObject> SqliteStatement::GetReturningBlob(int32_t index, int32_t type) const
+{
+    int size = sqlite3_column_bytes(stmt_, index);
+    auto blob = static_cast<const uint8_t *>(sqlite3_column_blob(stmt_, index));
+    // sqlite gives no pointer for the zero length blob, it is still an empty blob.
+    if (blob == nullptr || size <= 0) {
+        return { E_OK, ValueObject(std::vector<uint8_t>()) };
+    }
+    size_t used = 0;
+    ValueObject value;
+    switch (static_cast<ColumnType>(type)) {
+        case ColumnType::TYPE_ASSET: {
+            Asset asset;
+            used = RawDataParser::ParserRawData(blob, size, asset);
+            value = ValueObject(std::move(asset));
+            break;
+        }
+        case ColumnType::TYPE_ASSETS: {
+            Assets assets;
+            used = RawDataParser::ParserRawData(blob, size, assets);
+            value = ValueObject(std::move(assets));
+            break;
+        }
+        case ColumnType::TYPE_FLOAT32_ARRAY: {
+            Floats floats;
+            used = RawDataParser::ParserRawData(blob, size, floats);
+            value = ValueObject(std::move(floats));
+            break;
+        }
+        case ColumnType::TYPE_BIGINT: {
+            BigInt bigint;
+            used = RawDataParser::ParserRawData(blob, size, bigint);
+            value = ValueObject(std::move(bigint));
+            break;
+        }
+        default:
+            return { E_OK, ValueObject(std::vector<uint8_t>(blob, blob + size)) };
+    }
+    if (used == 0) {
+        LOG_ERROR("Invalid raw data, type:%{public}d, size:%{public}d, col:%{public}d.", type, size, index);
+        return { E_ERROR, ValueObject() };
+    }
+    return { E_OK, std::move(value) };
+}
+
 bool SqliteStatement::ReadOnly() const
 {
     return readOnly_;
@@ -788,6 +1042,7 @@ int32_t SqliteStatement::FillBlockInfo(SharedBlockInfo *info, int retryTime) con
     } else {
         errCode = FillSharedBlock(info, stmt_, retryTime);
     }
+    RefreshColumnInfo();
     if (errCode != E_OK) {
         if (config_ != nullptr) {
             Reportor::ReportFault(RdbFaultDbFileEvent(RdbFaultType::FT_CURD, errCode, *config_,
@@ -808,12 +1063,12 @@ int32_t SqliteStatement::FillBlockInfo(SharedBlockInfo *info, int retryTime) con
     return E_OK;
 }
 
-int32_t SqliteStatement::BindNil(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindNil(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     return sqlite3_bind_null(stat, index);
 }
 
-int32_t SqliteStatement::BindInteger(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindInteger(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<int64_t>(&arg);
     if (val == nullptr) {
@@ -822,7 +1077,7 @@ int32_t SqliteStatement::BindInteger(sqlite3_stmt *stat, int index, const ValueO
     return sqlite3_bind_int64(stat, index, *val);
 }
 
-int32_t SqliteStatement::BindDouble(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindDouble(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<double>(&arg);
     if (val == nullptr) {
@@ -831,16 +1086,16 @@ int32_t SqliteStatement::BindDouble(sqlite3_stmt *stat, int index, const ValueOb
     return sqlite3_bind_double(stat, index, *val);
 }
 
-int32_t SqliteStatement::BindText(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindText(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<std::string>(&arg);
     if (val == nullptr) {
         return SQLITE_MISMATCH;
     }
-    return sqlite3_bind_text(stat, index, val->c_str(), val->length(), SQLITE_TRANSIENT);
+    return sqlite3_bind_text(stat, index, val->c_str(), val->length(), destructor);
 }
 
-int32_t SqliteStatement::BindBool(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindBool(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<bool>(&arg);
     if (val == nullptr) {
@@ -849,7 +1104,7 @@ int32_t SqliteStatement::BindBool(sqlite3_stmt *stat, int index, const ValueObje
     return sqlite3_bind_int64(stat, index, *val ? 1 : 0);
 }
 
-int32_t SqliteStatement::BindBlob(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindBlob(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<std::vector<uint8_t>>(&arg);
     if (val == nullptr) {
@@ -859,10 +1114,10 @@ int32_t SqliteStatement::BindBlob(sqlite3_stmt *stat, int index, const ValueObje
     if (val->empty()) {
         return sqlite3_bind_zeroblob(stat, index, 0);
     }
-    return sqlite3_bind_blob(stat, index, static_cast<const void *>((*val).data()), (*val).size(), SQLITE_TRANSIENT);
+    return sqlite3_bind_blob(stat, index, static_cast<const void *>((*val).data()), (*val).size(), destructor);
 }
 
-int32_t SqliteStatement::BindAsset(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindAsset(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<Asset>(&arg);
     if (val == nullptr) {
@@ -872,7 +1127,7 @@ int32_t SqliteStatement::BindAsset(sqlite3_stmt *stat, int index, const ValueObj
     return sqlite3_bind_blob(stat, index, static_cast<const void *>(rawData.data()), rawData.size(), SQLITE_TRANSIENT);
 }
 
-int32_t SqliteStatement::BindAssets(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindAssets(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<Assets>(&arg);
     if (val == nullptr) {
@@ -882,7 +1137,8 @@ int32_t SqliteStatement::BindAssets(sqlite3_stmt *stat, int index, const ValueOb
     return sqlite3_bind_blob(stat, index, static_cast<const void *>(rawData.data()), rawData.size(), SQLITE_TRANSIENT);
 }
 
-int32_t SqliteStatement::BindFloats(sqlite3_stmt *stat, int index, const ValueObject::Type &object)
+int32_t SqliteStatement::BindFloats(
+    sqlite3_stmt *stat, int index, const ValueObject::Type &object, Destructor destructor)
 {
     auto val = std::get_if<Floats>(&object);
     if (val == nullptr) {
@@ -892,7 +1148,7 @@ int32_t SqliteStatement::BindFloats(sqlite3_stmt *stat, int index, const ValueOb
     return sqlite3_bind_blob(stat, index, static_cast<const void *>(rawData.data()), rawData.size(), SQLITE_TRANSIENT);
 }
 
-int32_t SqliteStatement::BindBigInt(sqlite3_stmt *stat, int index, const ValueObject::Type &arg)
+int32_t SqliteStatement::BindBigInt(sqlite3_stmt *stat, int index, const ValueObject::Type &arg, Destructor destructor)
 {
     auto val = std::get_if<BigInt>(&arg);
     if (val == nullptr) {
@@ -941,9 +1197,14 @@ int SqliteStatement::InnerFinalize()
         return E_OK;
     }
 
-    auto db = sqlite3_db_handle(stmt_);
-    int errCode = sqlite3_finalize(stmt_);
-    TryNotifyErrorLog(errCode, db, sql_);
+    int errCode = SQLITE_OK;
+    if (cache_ != nullptr) {
+        cache_->Release(sql_, stmt_, generation_);
+    } else {
+        auto db = sqlite3_db_handle(stmt_);
+        errCode = sqlite3_finalize(stmt_);
+        TryNotifyErrorLog(errCode, db, sql_);
+    }
     stmt_ = nullptr;
     sql_ = "";
     readOnly_ = false;
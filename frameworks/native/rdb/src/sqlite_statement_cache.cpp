@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define LOG_TAG "SqliteStatementCache"
+#include "sqlite_statement_cache.h"
+
+#include "logger.h"
+
+namespace OHOS {
+namespace NativeRdb {
+using namespace OHOS::Rdb;
+
+SqliteStatementCache::SqliteStatementCache(std::shared_ptr<Stat> stat, size_t capacity)
+    : capacity_(capacity), stat_(std::move(stat))
+{
+}
+
+SqliteStatementCache::~SqliteStatementCache()
+{
+    Clear();
+}
+
+std::pair<sqlite3_stmt *, uint64_t> SqliteStatementCache::Acquire(const std::string &sql)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    auto it = index_.find(sql);
+    if (it == index_.end()) {
+        misses_++;
+        if (stat_ != nullptr) {
+            stat_->misses_++;
+        }
+        return { nullptr, generation_ };
+    }
+    sqlite3_stmt *stmt = it->second->second;
+    entries_.erase(it->second);
+    index_.erase(it);
+    hits_++;
+    if (stat_ != nullptr) {
+        stat_->hits_++;
+    }
+    return { stmt, generation_ };
+}
+
+void SqliteStatementCache::Release(const std::string &sql, sqlite3_stmt *stmt, uint64_t generation)
+{
+    if (stmt == nullptr) {
+        return;
+    }
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    sqlite3_stmt *expired = stmt;
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        if (generation == generation_ && capacity_ > 0 && index_.find(sql) == index_.end()) {
+            entries_.emplace_front(sql, stmt);
+            index_[sql] = entries_.begin();
+            expired = nullptr;
+            if (entries_.size() > capacity_) {
+                expired = entries_.back().second;
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+    }
+    if (expired != nullptr) {
+        sqlite3_finalize(expired);
+    }
+}
+
+uint64_t SqliteStatementCache::GetGeneration()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return generation_;
+}
+
+void SqliteStatementCache::Clear()
+{
+    std::list<Entry> entries;
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        generation_++;
+        index_.clear();
+        entries.swap(entries_);
+    }
+    for (auto &[sql, stmt] : entries) {
+        int errCode = sqlite3_finalize(stmt);
+        if (errCode != SQLITE_OK) {
+            LOG_WARN("finalize cached statement ret is %{public}d", errCode);
+        }
+    }
+}
+
+size_t SqliteStatementCache::Size()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return entries_.size();
+}
+
+uint64_t SqliteStatementCache::GetHits() const
+{
+    return hits_;
+}
+
+uint64_t SqliteStatementCache::GetMisses() const
+{
+    return misses_;
+}
+} // namespace NativeRdb
+} // namespace OHOS
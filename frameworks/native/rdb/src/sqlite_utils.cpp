@@ -28,13 +28,14 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <list>
+#include <mutex>
 #include <unordered_map>
 #if !defined(CROSS_PLATFORM)
 #include <sqlite3.h>
 #include "relational/relational_store_sqlite_ext.h"
 #endif
 #include <fstream>
-#include <regex>
 #include <string>
 #include <sstream>
 #include <iomanip>
@@ -530,55 +531,88 @@ std::string SqliteUtils::AnonymousDigits(const std::string &digits, bool fullyAn
     return REPLACE_CHAIN + last;
 }
 
-std::string ByteAnonymous(const std::string &input)
+static bool IsWordByte(unsigned char byte)
 {
-    std::string output;
-    bool maskCurrent = false;
-    for (unsigned char byte : input) {
-        if (byte > MAX_PRINTABLE_BYTE) {
-            if (!maskCurrent) {
-                output += "***";
-                maskCurrent = true;
-            }
-        } else {
-            output.push_back(static_cast<char>(byte));
-            maskCurrent = false;
-        }
-    }
-    return output;
+    return (byte >= '0' && byte <= '9') || (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') ||
+           byte == '_';
 }
 
-std::string SqliteUtils::SqlAnonymous(const std::string &sql)
+static bool IsHexByte(unsigned char byte)
 {
-    std::ostringstream result;
-    std::regex idRegex(R"(\b[a-zA-Z0-9_]+\b)");
-    auto begin = std::sregex_iterator(sql.begin(), sql.end(), idRegex);
-    auto end = std::sregex_iterator();
-    bool fullyAnonymizeFollowingDigits = false;
-
-    size_t lastPos = 0;
-    for (auto it = begin; it != end; ++it) {
-        std::smatch match = *it;
-        std::string word = match.str();
-        size_t pos = static_cast<size_t>(match.position());
-
-        result << ByteAnonymous(sql.substr(lastPos, pos - lastPos));
+    return (byte >= '0' && byte <= '9') || (byte >= 'a' && byte <= 'f') || (byte >= 'A' && byte <= 'F');
+}
 
-        lastPos = pos + word.length();
+std::string SqliteUtils::DoSqlAnonymous(const std::string &sql)
+{
+    std::string result;
+    result.reserve(sql.size());
+    bool fullyAnonymizeFollowingDigits = false;
+    size_t pos = 0;
+    while (pos < sql.size()) {
+        // the bytes between the words are kept, except that each run of the non-ASCII bytes becomes one "***".
+        bool masked = false;
+        for (; pos < sql.size() && !IsWordByte(sql[pos]); ++pos) {
+            unsigned char byte = sql[pos];
+            if (byte <= MAX_PRINTABLE_BYTE) {
+                result.push_back(static_cast<char>(byte));
+                masked = false;
+            } else if (!masked) {
+                result.append(REPLACE_CHAIN);
+                masked = true;
+            }
+        }
+        if (pos >= sql.size()) {
+            break;
+        }
+        size_t begin = pos;
+        bool isHex = true;
+        for (; pos < sql.size() && IsWordByte(sql[pos]); ++pos) {
+            isHex = isHex && IsHexByte(sql[pos]);
+        }
+        std::string word = sql.substr(begin, pos - begin);
         if (IsKeyword(word)) {
-            result << std::move(word);
+            result.append(word);
             fullyAnonymizeFollowingDigits = false;
-        } else if (std::regex_match(word, std::regex(R"(\b[0-9a-fA-F]+\b)"))) {
-            result << AnonymousDigits(word, fullyAnonymizeFollowingDigits);
+        } else if (isHex) {
+            result.append(AnonymousDigits(word, fullyAnonymizeFollowingDigits));
             fullyAnonymizeFollowingDigits = true;
         } else {
-            result << GetAnonymousName(word);
+            result.append(GetAnonymousName(word));
             fullyAnonymizeFollowingDigits = false;
         }
     }
+    return result;
+}
 
-    result << ByteAnonymous(sql.substr(lastPos));
-    return result.str();
+std::string SqliteUtils::SqlAnonymous(const std::string &sql)
+{
+    if (sql.size() > SQL_ANONYMOUS_MAX_LENGTH) {
+        return DoSqlAnonymous(sql);
+    }
+    static std::mutex mutex;
+    // the front is the most recently used sql.
+    static std::list<std::pair<std::string, std::string>> entries;
+    static std::unordered_map<std::string, decltype(entries)::iterator> index;
+    {
+        std::lock_guard<decltype(mutex)> lock(mutex);
+        auto it = index.find(sql);
+        if (it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            return it->second->second;
+        }
+    }
+    auto result = DoSqlAnonymous(sql);
+    std::lock_guard<decltype(mutex)> lock(mutex);
+    if (index.find(sql) != index.end()) {
+        return result;
+    }
+    entries.emplace_front(sql, result);
+    index[sql] = entries.begin();
+    if (entries.size() > SQL_ANONYMOUS_CACHE_SIZE) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    return result;
 }
 
 std::string SqliteUtils::Anonymous(const std::string &srcFile)
@@ -716,8 +750,12 @@ int SqliteUtils::SetSlaveInvalid(const std::string &dbPath)
     return E_ERROR;
 }
 
-int SqliteUtils::SetSlaveInterrupted(const std::string &dbPath)
+int SqliteUtils::SetSlaveInterrupted(const std::string &dbPath, bool isInterrupted)
 {
+    if (!isInterrupted) {
+        std::remove((dbPath + SLAVE_INTERRUPT).c_str());
+        return E_OK;
+    }
     if (IsSlaveInterrupted(dbPath)) {
         return E_OK;
     }
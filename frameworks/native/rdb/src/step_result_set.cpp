@@ -41,6 +41,7 @@ StepResultSet::StepResultSet(
     }
 
     isGotoNextRowReturnLastError_ = options.isGotoNextRowReturnLastError;
+    windowBudget_ = options.windowBudget;
     auto prepareStart = std::chrono::steady_clock::now();
     auto errCode = PrepareStep();
     if (errCode != E_OK) {
@@ -160,6 +161,14 @@ int StepResultSet::GetColumnType(int columnIndex, ColumnType &columnType)
         SetLastErrorMsg(BuildRowRangeCtx());
         return E_ROW_OUT_RANGE;
     }
+    auto row = GetWindowRow();
+    if (row != nullptr) {
+        if (columnIndex < 0 || columnIndex >= static_cast<int>(row->types.size())) {
+            return E_COLUMN_OUT_RANGE;
+        }
+        columnType = static_cast<ColumnType>(row->types[columnIndex]);
+        return E_OK;
+    }
     auto statement = GetStatement();
     if (statement == nullptr) {
         LOG_ERROR("Statement is nullptr.");
@@ -201,6 +210,10 @@ int StepResultSet::GoToRow(int position)
     }
 
     if (position < rowPos_) {
+        if (InWindow(position)) {
+            rowPos_ = position;
+            return E_OK;
+        }
         Reset();
         return GoToRow(position);
     }
@@ -227,6 +240,17 @@ int StepResultSet::GoToNextRow()
         return E_ALREADY_CLOSED;
     }
 
+    if (rowPos_ != stepPos_ && InWindow(rowPos_)) {
+        // the window ends at the row of the statement, or at the end if all the rows have been stepped.
+        if (InWindow(rowPos_ + 1)) {
+            rowPos_++;
+            return E_OK;
+        }
+        rowPos_ = stepPos_;
+        SetLastErrorMsg(BuildRowRangeCtx());
+        return E_ROW_OUT_RANGE;
+    }
+
     auto statement = GetStatement();
     if (statement == nullptr) {
         LOG_ERROR("Statement is nullptr.");
@@ -251,6 +275,10 @@ int StepResultSet::GoToNextRow()
 
     if (errCode == E_OK) {
         rowPos_++;
+        stepPos_ = rowPos_;
+        if (windowBudget_ > 0) {
+            Capture(statement);
+        }
         return E_OK;
     } else if (errCode == E_NO_MORE_ROWS) {
         if (isSupportCountRow_ || rowCount_ != Statement::INVALID_COUNT) {
@@ -259,6 +287,7 @@ int StepResultSet::GoToNextRow()
             ++rowPos_;
             rowCount_ = rowPos_;
         }
+        stepPos_ = rowPos_;
         SetLastErrorMsg(BuildRowRangeCtx());
         return E_ROW_OUT_RANGE;
     } else {
@@ -323,6 +352,9 @@ int StepResultSet::GetRowCount(int &count)
 int StepResultSet::Reset()
 {
     rowPos_ = INIT_POS;
+    stepPos_ = INIT_POS;
+    window_.clear();
+    windowBytes_ = 0;
     auto statement = GetStatement();
     if (statement != nullptr) {
         return statement->Reset();
@@ -349,6 +381,27 @@ int StepResultSet::GetSize(int columnIndex, size_t &size)
         return E_ROW_OUT_RANGE;
     }
 
+    auto row = GetWindowRow();
+    if (row != nullptr) {
+        if (columnIndex < 0 || columnIndex >= static_cast<int>(row->types.size())) {
+            return E_COLUMN_OUT_RANGE;
+        }
+        auto type = static_cast<ColumnType>(row->types[columnIndex]);
+        auto &value = row->values[columnIndex];
+        if (type == ColumnType::TYPE_STRING) {
+            // Add 1 to size for the string terminator (null character).
+            size = std::get<std::string>(value.value).size() + 1;
+        } else if (type == ColumnType::TYPE_BLOB) {
+            auto blob = std::get_if<std::vector<uint8_t>>(&value.value);
+            size = blob == nullptr ? 0 : blob->size();
+        } else if (type == ColumnType::TYPE_NULL) {
+            size = 0;
+        } else {
+            return E_INVALID_COLUMN_TYPE;
+        }
+        return E_OK;
+    }
+
     auto statement = GetStatement();
     if (statement == nullptr) {
         LOG_ERROR("Statement is nullptr.");
@@ -377,11 +430,21 @@ std::pair<int, ValueObject> StepResultSet::GetValueObject(int32_t col, size_t in
         SetLastErrorMsg(BuildRowRangeCtx());
         return { E_ROW_OUT_RANGE, ValueObject() };
     }
-    auto statement = GetStatement();
-    if (statement == nullptr) {
-        return { E_ALREADY_CLOSED, ValueObject() };
+    int ret = E_OK;
+    ValueObject value;
+    auto row = GetWindowRow();
+    if (row != nullptr) {
+        ret = (col >= 0 && col < static_cast<int32_t>(row->values.size())) ? E_OK : E_COLUMN_OUT_RANGE;
+        if (ret == E_OK) {
+            value = row->values[col];
+        }
+    } else {
+        auto statement = GetStatement();
+        if (statement == nullptr) {
+            return { E_ALREADY_CLOSED, ValueObject() };
+        }
+        std::tie(ret, value) = statement->GetColumn(col);
     }
-    auto [ret, value] = statement->GetColumn(col);
     if (ret == E_COLUMN_OUT_RANGE) {
         SetLastErrorMsg("The columnIndex: " + std::to_string(col) + " is out of range");
     }
@@ -391,6 +454,131 @@ std::pair<int, ValueObject> StepResultSet::GetValueObject(int32_t col, size_t in
     return { ret, std::move(value) };
 }
 
+int StepResultSet::GetFloat32View(int32_t index, Float32View &view)
+{
+    if (rowPos_ == INIT_POS || ((isSupportCountRow_ || rowCount_ != Statement::INVALID_COUNT) && IsEnded().second)) {
+        SetLastErrorMsg(BuildRowRangeCtx());
+        return E_ROW_OUT_RANGE;
+    }
+    auto row = GetWindowRow();
+    if (row == nullptr) {
+        auto statement = GetStatement();
+        if (statement == nullptr) {
+            return E_ALREADY_CLOSED;
+        }
+        int errCode = E_OK;
+        std::tie(errCode, view) = statement->GetFloat32View(index);
+        return errCode;
+    }
+    if (index < 0 || index >= static_cast<int32_t>(row->values.size())) {
+        SetLastErrorMsg("The columnIndex: " + std::to_string(index) + " is out of range");
+        return E_COLUMN_OUT_RANGE;
+    }
+    auto &value = row->values[index];
+    if (value.GetType() == ValueObject::TYPE_NULL) {
+        return E_NULL_OBJECT;
+    }
+    auto vectors = std::get_if<ValueObject::FloatVector>(&value.value);
+    if (vectors == nullptr) {
+        return E_INVALID_OBJECT_TYPE;
+    }
+    view.data = vectors->data();
+    view.size = vectors->size();
+    return E_OK;
+}
+
+int StepResultSet::GetFloat32Array(int32_t index, ValueObject::FloatVector &vecs)
+{
+    Float32View view;
+    auto errCode = GetFloat32View(index, view);
+    if (errCode == E_NOT_SUPPORT) {
+        return AbsResultSet::GetFloat32Array(index, vecs);
+    }
+    if (errCode == E_OK) {
+        vecs.assign(view.begin(), view.end());
+    }
+    return errCode;
+}
+
+int StepResultSet::FetchRow(ColumnBatch &batch)
+{
+    if (rowPos_ == INIT_POS || ((isSupportCountRow_ || rowCount_ != Statement::INVALID_COUNT) && IsEnded().second)) {
+        SetLastErrorMsg(BuildRowRangeCtx());
+        return E_ROW_OUT_RANGE;
+    }
+    auto row = GetWindowRow();
+    if (row != nullptr) {
+        for (size_t col = 0; col < batch.columns.size() && col < row->values.size(); ++col) {
+            auto errCode = batch.columns[col].PutValue(row->values[col]);
+            if (errCode != E_OK) {
+                return errCode;
+            }
+        }
+        return E_OK;
+    }
+    auto statement = GetStatement();
+    if (statement == nullptr) {
+        return E_ALREADY_CLOSED;
+    }
+    return statement->FetchRow(batch);
+}
+
+void StepResultSet::Capture(const std::shared_ptr<Statement> &statement)
+{
+    if (!window_.empty() && windowStart_ + static_cast<int>(window_.size()) != rowPos_) {
+        window_.clear();
+        windowBytes_ = 0;
+    }
+    Row row;
+    auto colCount = statement->GetColumnCount();
+    row.values.reserve(colCount);
+    row.types.reserve(colCount);
+    row.bytes = sizeof(Row) + colCount * (sizeof(ValueObject) + sizeof(int32_t));
+    for (int32_t col = 0; col < colCount; ++col) {
+        auto [errCode, value] = statement->GetColumn(col);
+        auto [typeErr, type] = statement->GetColumnType(col);
+        if (errCode != E_OK || typeErr != E_OK) {
+            // the window must be contiguous, the rows before can not be kept either.
+            window_.clear();
+            windowBytes_ = 0;
+            return;
+        }
+        if (auto text = std::get_if<std::string>(&value.value)) {
+            row.bytes += text->size();
+        } else if (auto blob = std::get_if<std::vector<uint8_t>>(&value.value)) {
+            row.bytes += blob->size();
+        } else if (auto floats = std::get_if<ValueObject::FloatVector>(&value.value)) {
+            row.bytes += floats->size() * sizeof(float);
+        }
+        row.values.push_back(std::move(value));
+        row.types.push_back(type);
+    }
+    if (window_.empty()) {
+        windowStart_ = rowPos_;
+    }
+    windowBytes_ += row.bytes;
+    window_.push_back(std::move(row));
+    while (windowBytes_ > windowBudget_ && !window_.empty()) {
+        windowBytes_ -= window_.front().bytes;
+        window_.pop_front();
+        windowStart_++;
+    }
+}
+
+bool StepResultSet::InWindow(int position) const
+{
+    return !window_.empty() && position >= windowStart_ &&
+           position < windowStart_ + static_cast<int>(window_.size());
+}
+
+const StepResultSet::Row *StepResultSet::GetWindowRow() const
+{
+    if (rowPos_ == stepPos_ || !InWindow(rowPos_)) {
+        return nullptr;
+    }
+    return &window_[rowPos_ - windowStart_];
+}
+
 std::shared_ptr<Statement> StepResultSet::GetStatement()
 {
     std::lock_guard<decltype(globalMtx_)> lockGuard(globalMtx_);
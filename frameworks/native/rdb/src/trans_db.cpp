@@ -85,19 +85,22 @@ std::pair<int, int64_t> TransDB::BatchInsert(const std::string &table, const Ref
         return { E_OK, 0 };
     }
 
-    auto batchInfo = SqliteSqlBuilder::GenerateSqls(table, rows, maxArgs_);
-    if (table.empty() || batchInfo.empty()) {
+    auto batchSqls = SqliteSqlBuilder::GenerateBatchSqls(table, rows, maxArgs_);
+    if (table.empty() || batchSqls.empty()) {
         LOG_ERROR("empty,table=%{public}s,rows:%{public}zu,max:%{public}d.", SqliteUtils::Anonymous(table).c_str(),
             rows.RowSize(), maxArgs_);
         return { E_INVALID_ARGS, -1 };
     }
 
-    for (const auto &[sql, batchArgs] : batchInfo) {
+    std::vector<SqliteSqlBuilder::RefValue> args;
+    size_t begin = 0;
+    for (const auto &[sql, chunkRows, times] : batchSqls) {
         auto [errCode, statement] = GetStatement(sql);
         if (statement == nullptr) {
             return { errCode, -1 };
         }
-        for (const auto &args : batchArgs) {
+        for (size_t i = 0; i < times; ++i, begin += chunkRows) {
+            SqliteSqlBuilder::FillBatchArgs(rows, begin, chunkRows, args);
             errCode = statement->Execute(args);
             if (errCode == E_OK) {
                 continue;
@@ -118,27 +121,29 @@ std::pair<int32_t, Results> TransDB::BatchInsert(const std::string &table, const
         return { E_OK, 0 };
     }
 
-    auto sqlArgs = SqliteSqlBuilder::GenerateSqls(table, rows, maxArgs_, resolution);
-    if (sqlArgs.size() != 1 || sqlArgs.front().second.size() != 1) {
-        auto [fields, values] = rows.GetFieldsAndValues();
+    auto batchSqls = SqliteSqlBuilder::GenerateBatchSqls(table, rows, maxArgs_, resolution);
+    // To ensure atomicity, execute SQL only once
+    if (batchSqls.size() != 1 || batchSqls.front().times != 1) {
+        auto fields = rows.GetFields();
         LOG_ERROR("invalid args, table=%{public}s, rows:%{public}zu, fields:%{public}zu, max:%{public}d.",
             SqliteUtils::Anonymous(table).c_str(), rows.RowSize(), fields != nullptr ? fields->size() : 0, maxArgs_);
         return { E_INVALID_ARGS, -1 };
     }
-    auto &[sql, bindArgs] = sqlArgs.front();
+    auto &batchSql = batchSqls.front();
     auto returningSql = SqliteSqlBuilder::GetReturningSql(config.columns);
-    auto [errCode, statement] = GetStatement(sql, returningSql);
+    auto [errCode, statement] = GetStatement(batchSql.sql, returningSql);
     if (statement == nullptr) {
-        LOG_ERROR("statement is nullptr, errCode:0x%{public}x, args:%{public}zu, table:%{public}s.", errCode,
-            bindArgs.size(), SqliteUtils::Anonymous(table).c_str());
+        LOG_ERROR("statement is nullptr, errCode:0x%{public}x, rows:%{public}zu, table:%{public}s.", errCode,
+            batchSql.rows, SqliteUtils::Anonymous(table).c_str());
         return { errCode, -1 };
     }
-    auto args = std::ref(bindArgs.front());
-    std::vector<ValuesBucket> values;
-    std::tie(errCode, values) = statement->ExecuteForRows(args, config.maxReturningCount);
+    std::vector<SqliteSqlBuilder::RefValue> args;
+    SqliteSqlBuilder::FillBatchArgs(rows, 0, batchSql.rows, args);
+    ReturningRows values;
+    std::tie(errCode, values) = statement->ExecuteForReturning(args, config.maxReturningCount);
     if (errCode != E_OK) {
         LOG_ERROR("failed,errCode:%{public}d,table:%{public}s,args:%{public}zu,resolution:%{public}d.", errCode,
-            SqliteUtils::Anonymous(table).c_str(), args.get().size(), static_cast<int32_t>(resolution));
+            SqliteUtils::Anonymous(table).c_str(), args.size(), static_cast<int32_t>(resolution));
     }
     return GenerateResult(errCode, statement, std::move(values), true, config.defaultRowIndex);
 }
@@ -181,8 +186,8 @@ std::pair<int32_t, Results> TransDB::Update(const Row &row, const AbsRdbPredicat
     if (errCode != E_OK || statement == nullptr) {
         return { errCode != E_OK ? errCode : E_ERROR, -1 };
     }
-    std::vector<ValuesBucket> values;
-    std::tie(errCode, values) = statement->ExecuteForRows(totalArgs, config.maxReturningCount);
+    ReturningRows values;
+    std::tie(errCode, values) = statement->ExecuteForReturning(totalArgs, config.maxReturningCount);
     if (errCode != E_OK) {
         LOG_ERROR("failed,errCode:%{public}d,table:%{public}s,returningFields:%{public}zu,resolution:%{public}d.",
             errCode, SqliteUtils::Anonymous(table).c_str(), config.columns.size(), static_cast<int32_t>(resolution));
@@ -210,8 +215,8 @@ std::pair<int32_t, Results> TransDB::Delete(
     if (errCode != E_OK || statement == nullptr) {
         return { errCode != E_OK ? errCode : E_ERROR, -1 };
     }
-    std::vector<ValuesBucket> values;
-    std::tie(errCode, values) = statement->ExecuteForRows(predicates.GetBindArgs(), config.maxReturningCount);
+    ReturningRows values;
+    std::tie(errCode, values) = statement->ExecuteForReturning(predicates.GetBindArgs(), config.maxReturningCount);
     if (errCode != E_OK) {
         LOG_ERROR("failed,errCode:%{public}d,table:%{public}s,returningFields:%{public}zu.", errCode,
             SqliteUtils::Anonymous(table).c_str(), config.columns.size());
@@ -220,14 +225,21 @@ std::pair<int32_t, Results> TransDB::Delete(
 }
 
 std::shared_ptr<AbsSharedResultSet> TransDB::QuerySql(const std::string &sql, const Values &args)
+{
+    return QuerySql(sql, args, QueryOptions());
+}
+
+std::shared_ptr<AbsSharedResultSet> TransDB::QuerySql(const std::string &sql, const Values &args,
+    const QueryOptions &options)
 {
 #if !defined(WINDOWS_PLATFORM) && !defined(MAC_PLATFORM) && !defined(ANDROID_PLATFORM) && !defined(IOS_PLATFORM)
     DISTRIBUTED_DATA_HITRACE(std::string(__FUNCTION__));
     auto start = std::chrono::steady_clock::now();
-    return std::make_shared<SqliteSharedResultSet>(start, conn_.lock(), sql, args, path_);
+    return std::make_shared<SqliteSharedResultSet>(start, conn_.lock(), sql, args, path_, options);
 #else
     (void)sql;
     (void)args;
+    (void)options;
     return nullptr;
 #endif
 }
@@ -298,8 +310,8 @@ std::pair<int32_t, Results> TransDB::ExecuteExt(const std::string &sql, const Va
     if (errCode != E_OK || statement == nullptr) {
         return { errCode != E_OK ? errCode : E_ERROR, -1 };
     }
-    std::vector<ValuesBucket> rows;
-    std::tie(errCode, rows) = statement->ExecuteForRows(args, ReturningConfig::DEFAULT_RETURNING_COUNT);
+    ReturningRows rows;
+    std::tie(errCode, rows) = statement->ExecuteForReturning(args, ReturningConfig::DEFAULT_RETURNING_COUNT);
     Results result;
     std::tie(errCode, result) = GenerateResult(errCode, statement, std::move(rows),
         sqlType == SqliteUtils::STATEMENT_INSERT || sqlType == SqliteUtils::STATEMENT_UPDATE);
@@ -358,7 +370,7 @@ std::pair<int32_t, std::shared_ptr<Statement>> TransDB::GetStatement(
 }
 
 std::pair<int32_t, Results> TransDB::GenerateResult(int32_t code, std::shared_ptr<Statement> statement,
-    std::vector<ValuesBucket> &&returningValues, bool isDML, int32_t rowIndex)
+    ReturningRows &&returningRows, bool isDML, int32_t rowIndex)
 {
     Results result{ -1 };
     if (statement == nullptr) {
@@ -366,8 +378,8 @@ std::pair<int32_t, Results> TransDB::GenerateResult(int32_t code, std::shared_pt
     }
     // There are no data changes in other scenarios
     if (code == E_OK) {
-        std::shared_ptr<ResultSet> resultSet =
-            std::make_shared<CacheResultSet>(std::move(returningValues), rowIndex);
+        std::shared_ptr<ResultSet> resultSet = std::make_shared<CacheResultSet>(
+            std::move(returningRows.columns), std::move(returningRows.values), rowIndex);
         result.results = resultSet;
         result.changed = isDML ? statement->Changes() : 0;
     }
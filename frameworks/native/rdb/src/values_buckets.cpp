@@ -14,6 +14,8 @@
  */
 #include "values_buckets.h"
 
+#include <algorithm>
+
 #include "rdb_errno.h"
 
 namespace OHOS {
@@ -21,12 +23,12 @@ namespace NativeRdb {
 ValuesBuckets::ValuesBuckets()
 {
     fields_ = std::make_shared<std::set<std::string>>();
-    values_ = std::make_shared<std::set<ValueObject>>();
+    offsets_.push_back(0);
 }
 
 ValuesBuckets::ValuesBuckets(const std::vector<ValuesBucket> &rows) : ValuesBuckets()
 {
-    buckets_.reserve(rows.size());
+    offsets_.reserve(rows.size() + 1);
     for (const auto &bucket : rows) {
         Put(bucket);
     }
@@ -34,73 +36,182 @@ ValuesBuckets::ValuesBuckets(const std::vector<ValuesBucket> &rows) : ValuesBuck
 
 ValuesBuckets::ValuesBuckets(std::vector<ValuesBucket> &&rows) noexcept : ValuesBuckets()
 {
-    buckets_.reserve(rows.size());
+    offsets_.reserve(rows.size() + 1);
     for (auto &bucket : rows) {
         Put(std::move(bucket));
     }
 }
 
+ValuesBuckets::ValuesBuckets(const std::vector<std::string> &fields) : ValuesBuckets()
+{
+    for (const auto &field : fields) {
+        GetIndex(field);
+    }
+}
+
+ValuesBuckets::ValuesBuckets(const ValuesBuckets &other)
+    : fields_(std::make_shared<std::set<std::string>>()), values_(other.values_), indexes_(other.indexes_),
+      offsets_(other.offsets_), exists_(other.exists_)
+{
+    if (other.fields_ != nullptr) {
+        *fields_ = *other.fields_;
+    }
+}
+
+ValuesBuckets &ValuesBuckets::operator=(const ValuesBuckets &other)
+{
+    if (this != &other) {
+        ValuesBuckets copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
 size_t ValuesBuckets::RowSize() const
 {
-    return buckets_.size();
+    return offsets_.size() - 1;
+}
+
+ValuesBuckets::FieldsType ValuesBuckets::GetFields() const
+{
+    return fields_;
 }
 
 std::pair<ValuesBuckets::FieldsType, ValuesBuckets::ValuesType> ValuesBuckets::GetFieldsAndValues() const
 {
-    return { fields_, values_ };
+    auto values = std::make_shared<std::set<ValueObject>>();
+    for (size_t index = 0; index < values_.size(); ++index) {
+        if (exists_[index]) {
+            values->insert(values_[index]);
+        }
+    }
+    return { fields_, values };
+}
+
+bool ValuesBuckets::AnyOf(const std::function<bool(const ValueObject &)> &action) const
+{
+    for (size_t index = 0; index < values_.size(); ++index) {
+        if (exists_[index] && action(values_[index])) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void ValuesBuckets::Reserve(int32_t size)
 {
-    buckets_.reserve(size);
+    if (size <= 0) {
+        return;
+    }
+    offsets_.reserve(static_cast<size_t>(size) + 1);
+    values_.reserve(static_cast<size_t>(size) * std::max(indexes_.size(), size_t(1)));
+    exists_.reserve(values_.capacity());
 }
 
 void ValuesBuckets::Clear()
 {
-    buckets_.clear();
     fields_->clear();
-    values_->clear();
+    values_.clear();
+    indexes_.clear();
+    offsets_.assign(1, 0);
+    exists_.clear();
+}
+
+size_t ValuesBuckets::GetIndex(const std::string &field)
+{
+    auto it = indexes_.find(field);
+    if (it != indexes_.end()) {
+        return it->second;
+    }
+    fields_->insert(field);
+    auto index = indexes_.size();
+    indexes_.emplace(field, index);
+    return index;
+}
+
+size_t ValuesBuckets::AddRow()
+{
+    auto start = values_.size();
+    values_.resize(start + indexes_.size());
+    exists_.resize(values_.size(), false);
+    offsets_.push_back(values_.size());
+    return start;
 }
 
 void ValuesBuckets::Put(const ValuesBucket &bucket)
 {
-    BucketType row;
+    auto start = AddRow();
     for (const auto &[field, value] : bucket.values_) {
-        auto fieldResult = fields_->insert(field);
-        auto valueResult = values_->insert(value);
-        row.insert(std::make_pair(std::ref(const_cast<std::string &>(*fieldResult.first)),
-            std::ref(const_cast<ValueObject &>(*valueResult.first))));
+        auto index = start + GetIndex(field);
+        if (index >= values_.size()) {
+            values_.resize(index + 1);
+            exists_.resize(index + 1, false);
+            offsets_.back() = index + 1;
+        }
+        values_[index] = value;
+        exists_[index] = true;
     }
-    buckets_.push_back(std::move(row));
 }
 
 void ValuesBuckets::Put(ValuesBucket &&bucket)
 {
-    BucketType row;
+    auto start = AddRow();
     for (auto &[field, value] : bucket.values_) {
-        auto fieldResult = fields_->insert(std::move(field));
-        auto valueResult = values_->insert(std::move(value));
-        row.insert(std::make_pair(std::ref(const_cast<std::string &>(*fieldResult.first)),
-            std::ref(const_cast<ValueObject &>(*valueResult.first))));
+        auto index = start + GetIndex(field);
+        if (index >= values_.size()) {
+            values_.resize(index + 1);
+            exists_.resize(index + 1, false);
+            offsets_.back() = index + 1;
+        }
+        values_[index] = std::move(value);
+        exists_[index] = true;
+    }
+}
+
+int ValuesBuckets::Put(std::vector<ValueObject> &&values)
+{
+    if (values.size() > indexes_.size()) {
+        return E_INVALID_ARGS;
     }
-    buckets_.push_back(std::move(row));
+    auto start = AddRow();
+    for (size_t i = 0; i < values.size(); ++i) {
+        values_[start + i] = std::move(values[i]);
+        exists_[start + i] = true;
+    }
+    return E_OK;
 }
 
 std::pair<int, ValuesBuckets::ValueType> ValuesBuckets::Get(size_t row, const FieldType &field) const
 {
-    ValueObject empty;
-    std::reference_wrapper<ValueObject> emptyRef(empty);
-    if (row >= buckets_.size()) {
+    std::reference_wrapper<ValueObject> emptyRef(empty_);
+    if (row >= RowSize()) {
         return { E_INVALID_ARGS, emptyRef };
     }
 
-    auto &bucket = buckets_[row];
-    auto it = bucket.find(field);
-    if (it == bucket.end()) {
+    auto it = indexes_.find(field.get());
+    if (it == indexes_.end()) {
+        return { E_INVALID_ARGS, emptyRef };
+    }
+    auto index = offsets_[row] + it->second;
+    if (index >= offsets_[row + 1] || !exists_[index]) {
         return { E_INVALID_ARGS, emptyRef };
     }
+    return { E_OK, const_cast<ValueObject &>(values_[index]) };
+}
 
-    return { E_OK, it->second };
+ValuesBucket ValuesBuckets::GetBucket(size_t row) const
+{
+    ValuesBucket bucket;
+    if (row >= RowSize()) {
+        return bucket;
+    }
+    for (const auto &[field, index] : indexes_) {
+        auto pos = offsets_[row] + index;
+        if (pos < offsets_[row + 1] && exists_[pos]) {
+            bucket.values_.emplace(field, values_[pos]);
+        }
+    }
+    return bucket;
 }
 } // namespace NativeRdb
 } // namespace OHOS
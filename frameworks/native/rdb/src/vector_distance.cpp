@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "vector_distance.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSE__) || defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace OHOS {
+namespace NativeRdb {
+namespace {
+// the independent accumulators hide the latency of the adds.
+constexpr size_t UNROLL = 4;
+
+struct DistanceOps {
+    float (*l2Square)(const float *lhs, const float *rhs, size_t size);
+    float (*dot)(const float *lhs, const float *rhs, size_t size);
+    void (*cosine)(const float *lhs, const float *rhs, size_t size, float (&sums)[3]);
+};
+
+float L2SquareScalar(const float *lhs, const float *rhs, size_t size)
+{
+    float sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+        float diff = lhs[i] - rhs[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+float DotScalar(const float *lhs, const float *rhs, size_t size)
+{
+    float sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+        sum += lhs[i] * rhs[i];
+    }
+    return sum;
+}
+
+void CosineScalar(const float *lhs, const float *rhs, size_t size, float (&sums)[3])
+{
+    for (size_t i = 0; i < size; ++i) {
+        sums[0] += lhs[i] * rhs[i];
+        sums[1] += lhs[i] * lhs[i];
+        sums[2] += rhs[i] * rhs[i];
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+constexpr size_t NEON_LANES = 4;
+
+inline float32x4_t MulAdd(float32x4_t acc, float32x4_t lhs, float32x4_t rhs)
+{
+#if defined(__aarch64__)
+    return vfmaq_f32(acc, lhs, rhs);
+#else
+    return vmlaq_f32(acc, lhs, rhs);
+#endif
+}
+
+inline float HorizontalSum(float32x4_t sum)
+{
+#if defined(__aarch64__)
+    return vaddvq_f32(sum);
+#else
+    float32x2_t half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    return vget_lane_f32(vpadd_f32(half, half), 0);
+#endif
+}
+
+float L2SquareNeon(const float *lhs, const float *rhs, size_t size)
+{
+    float32x4_t sums[UNROLL] = { vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0) };
+    size_t i = 0;
+    for (; i + UNROLL * NEON_LANES <= size; i += UNROLL * NEON_LANES) {
+        for (size_t k = 0; k < UNROLL; ++k) {
+            size_t offset = i + k * NEON_LANES;
+            float32x4_t diff = vsubq_f32(vld1q_f32(lhs + offset), vld1q_f32(rhs + offset));
+            sums[k] = MulAdd(sums[k], diff, diff);
+        }
+    }
+    for (; i + NEON_LANES <= size; i += NEON_LANES) {
+        float32x4_t diff = vsubq_f32(vld1q_f32(lhs + i), vld1q_f32(rhs + i));
+        sums[0] = MulAdd(sums[0], diff, diff);
+    }
+    float32x4_t sum = vaddq_f32(vaddq_f32(sums[0], sums[1]), vaddq_f32(sums[2], sums[3]));
+    return HorizontalSum(sum) + L2SquareScalar(lhs + i, rhs + i, size - i);
+}
+
+float DotNeon(const float *lhs, const float *rhs, size_t size)
+{
+    float32x4_t sums[UNROLL] = { vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0) };
+    size_t i = 0;
+    for (; i + UNROLL * NEON_LANES <= size; i += UNROLL * NEON_LANES) {
+        for (size_t k = 0; k < UNROLL; ++k) {
+            size_t offset = i + k * NEON_LANES;
+            sums[k] = MulAdd(sums[k], vld1q_f32(lhs + offset), vld1q_f32(rhs + offset));
+        }
+    }
+    for (; i + NEON_LANES <= size; i += NEON_LANES) {
+        sums[0] = MulAdd(sums[0], vld1q_f32(lhs + i), vld1q_f32(rhs + i));
+    }
+    float32x4_t sum = vaddq_f32(vaddq_f32(sums[0], sums[1]), vaddq_f32(sums[2], sums[3]));
+    return HorizontalSum(sum) + DotScalar(lhs + i, rhs + i, size - i);
+}
+
+void CosineNeon(const float *lhs, const float *rhs, size_t size, float (&sums)[3])
+{
+    float32x4_t dot = vdupq_n_f32(0);
+    float32x4_t lhsNorm = vdupq_n_f32(0);
+    float32x4_t rhsNorm = vdupq_n_f32(0);
+    size_t i = 0;
+    for (; i + NEON_LANES <= size; i += NEON_LANES) {
+        float32x4_t left = vld1q_f32(lhs + i);
+        float32x4_t right = vld1q_f32(rhs + i);
+        dot = MulAdd(dot, left, right);
+        lhsNorm = MulAdd(lhsNorm, left, left);
+        rhsNorm = MulAdd(rhsNorm, right, right);
+    }
+    sums[0] = HorizontalSum(dot);
+    sums[1] = HorizontalSum(lhsNorm);
+    sums[2] = HorizontalSum(rhsNorm);
+    CosineScalar(lhs + i, rhs + i, size - i, sums);
+}
+#elif defined(__SSE__) || defined(__x86_64__)
+constexpr size_t SSE_LANES = 4;
+constexpr size_t AVX_LANES = 8;
+
+inline float HorizontalSum(__m128 sum)
+{
+    __m128 half = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    return _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, 1)));
+}
+
+float L2SquareSse(const float *lhs, const float *rhs, size_t size)
+{
+    __m128 sums[UNROLL] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+    size_t i = 0;
+    for (; i + UNROLL * SSE_LANES <= size; i += UNROLL * SSE_LANES) {
+        for (size_t k = 0; k < UNROLL; ++k) {
+            size_t offset = i + k * SSE_LANES;
+            __m128 diff = _mm_sub_ps(_mm_loadu_ps(lhs + offset), _mm_loadu_ps(rhs + offset));
+            sums[k] = _mm_add_ps(sums[k], _mm_mul_ps(diff, diff));
+        }
+    }
+    for (; i + SSE_LANES <= size; i += SSE_LANES) {
+        __m128 diff = _mm_sub_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i));
+        sums[0] = _mm_add_ps(sums[0], _mm_mul_ps(diff, diff));
+    }
+    __m128 sum = _mm_add_ps(_mm_add_ps(sums[0], sums[1]), _mm_add_ps(sums[2], sums[3]));
+    return HorizontalSum(sum) + L2SquareScalar(lhs + i, rhs + i, size - i);
+}
+
+float DotSse(const float *lhs, const float *rhs, size_t size)
+{
+    __m128 sums[UNROLL] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+    size_t i = 0;
+    for (; i + UNROLL * SSE_LANES <= size; i += UNROLL * SSE_LANES) {
+        for (size_t k = 0; k < UNROLL; ++k) {
+            size_t offset = i + k * SSE_LANES;
+            sums[k] = _mm_add_ps(sums[k], _mm_mul_ps(_mm_loadu_ps(lhs + offset), _mm_loadu_ps(rhs + offset)));
+        }
+    }
+    for (; i + SSE_LANES <= size; i += SSE_LANES) {
+        sums[0] = _mm_add_ps(sums[0], _mm_mul_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+    }
+    __m128 sum = _mm_add_ps(_mm_add_ps(sums[0], sums[1]), _mm_add_ps(sums[2], sums[3]));
+    return HorizontalSum(sum) + DotScalar(lhs + i, rhs + i, size - i);
+}
+
+void CosineSse(const float *lhs, const float *rhs, size_t size, float (&sums)[3])
+{
+    __m128 dot = _mm_setzero_ps();
+    __m128 lhsNorm = _mm_setzero_ps();
+    __m128 rhsNorm = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + SSE_LANES <= size; i += SSE_LANES) {
+        __m128 left = _mm_loadu_ps(lhs + i);
+        __m128 right = _mm_loadu_ps(rhs + i);
+        dot = _mm_add_ps(dot, _mm_mul_ps(left, right));
+        lhsNorm = _mm_add_ps(lhsNorm, _mm_mul_ps(left, left));
+        rhsNorm = _mm_add_ps(rhsNorm, _mm_mul_ps(right, right));
+    }
+    sums[0] = HorizontalSum(dot);
+    sums[1] = HorizontalSum(lhsNorm);
+    sums[2] = HorizontalSum(rhsNorm);
+    CosineScalar(lhs + i, rhs + i, size - i, sums);
+}
+
+#if defined(__GNUC__)
+// The AVX2 kernels are built for the target of their own and chosen at runtime, the others stay on the baseline.
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+AVX2_TARGET inline float HorizontalSum256(__m256 sum)
+{
+    return HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1)));
+}
+
+AVX2_TARGET float L2SquareAvx2(const float *lhs, const float *rhs, size_t size)
+{
+    __m256 sums[UNROLL] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+    size_t i = 0;
+    for (; i + UNROLL * AVX_LANES <= size; i += UNROLL * AVX_LANES) {
+        for (size_t k = 0; k < UNROLL; ++k) {
+            size_t offset = i + k * AVX_LANES;
+            __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(lhs + offset), _mm256_loadu_ps(rhs + offset));
+            sums[k] = _mm256_fmadd_ps(diff, diff, sums[k]);
+        }
+    }
+    for (; i + AVX_LANES <= size; i += AVX_LANES) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i));
+        sums[0] = _mm256_fmadd_ps(diff, diff, sums[0]);
+    }
+    __m256 sum = _mm256_add_ps(_mm256_add_ps(sums[0], sums[1]), _mm256_add_ps(sums[2], sums[3]));
+    return HorizontalSum256(sum) + L2SquareScalar(lhs + i, rhs + i, size - i);
+}
+
+AVX2_TARGET float DotAvx2(const float *lhs, const float *rhs, size_t size)
+{
+    __m256 sums[UNROLL] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+    size_t i = 0;
+    for (; i + UNROLL * AVX_LANES <= size; i += UNROLL * AVX_LANES) {
+        for (size_t k = 0; k < UNROLL; ++k) {
+            size_t offset = i + k * AVX_LANES;
+            sums[k] = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + offset), _mm256_loadu_ps(rhs + offset), sums[k]);
+        }
+    }
+    for (; i + AVX_LANES <= size; i += AVX_LANES) {
+        sums[0] = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i), sums[0]);
+    }
+    __m256 sum = _mm256_add_ps(_mm256_add_ps(sums[0], sums[1]), _mm256_add_ps(sums[2], sums[3]));
+    return HorizontalSum256(sum) + DotScalar(lhs + i, rhs + i, size - i);
+}
+
+AVX2_TARGET void CosineAvx2(const float *lhs, const float *rhs, size_t size, float (&sums)[3])
+{
+    __m256 dot = _mm256_setzero_ps();
+    __m256 lhsNorm = _mm256_setzero_ps();
+    __m256 rhsNorm = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + AVX_LANES <= size; i += AVX_LANES) {
+        __m256 left = _mm256_loadu_ps(lhs + i);
+        __m256 right = _mm256_loadu_ps(rhs + i);
+        dot = _mm256_fmadd_ps(left, right, dot);
+        lhsNorm = _mm256_fmadd_ps(left, left, lhsNorm);
+        rhsNorm = _mm256_fmadd_ps(right, right, rhsNorm);
+    }
+    sums[0] = HorizontalSum256(dot);
+    sums[1] = HorizontalSum256(lhsNorm);
+    sums[2] = HorizontalSum256(rhsNorm);
+    CosineScalar(lhs + i, rhs + i, size - i, sums);
+}
+#undef AVX2_TARGET
+#endif
+#endif
+
+DistanceOps SelectDistanceOps()
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    return { &L2SquareNeon, &DotNeon, &CosineNeon };
+#elif defined(__SSE__) || defined(__x86_64__)
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return { &L2SquareAvx2, &DotAvx2, &CosineAvx2 };
+    }
+#endif
+    return { &L2SquareSse, &DotSse, &CosineSse };
+#else
+    return { &L2SquareScalar, &DotScalar, &CosineScalar };
+#endif
+}
+
+const DistanceOps &GetDistanceOps()
+{
+    static const DistanceOps ops = SelectDistanceOps();
+    return ops;
+}
+} // namespace
+
+float VectorDistance::L2Square(const float *lhs, const float *rhs, size_t size)
+{
+    return GetDistanceOps().l2Square(lhs, rhs, size);
+}
+
+float VectorDistance::Dot(const float *lhs, const float *rhs, size_t size)
+{
+    return GetDistanceOps().dot(lhs, rhs, size);
+}
+
+void VectorDistance::Cosine(const float *lhs, const float *rhs, size_t size, float (&sums)[3])
+{
+    sums[0] = 0;
+    sums[1] = 0;
+    sums[2] = 0;
+    GetDistanceOps().cosine(lhs, rhs, size, sums);
+}
+} // namespace NativeRdb
+} // namespace OHOS
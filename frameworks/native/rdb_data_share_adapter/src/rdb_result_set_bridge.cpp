@@ -15,10 +15,14 @@
 #define LOG_TAG "RdbResultSetBridge"
 #include "rdb_result_set_bridge.h"
 
+#include <algorithm>
+
+#include "abs_shared_result_set.h"
 #include "logger.h"
 #include "rdb_errno.h"
 #include "result_set.h"
 #include "securec.h"
+#include "shared_block.h"
 
 namespace OHOS {
 namespace RdbDataShareAdapter {
@@ -77,6 +81,10 @@ int RdbResultSetBridge::OnGo(int32_t start, int32_t target, Writer &writer)
 
 int32_t RdbResultSetBridge::WriteBlock(int32_t start, int32_t target, int columnCount, Writer &writer)
 {
+    auto sharedResultSet = std::dynamic_pointer_cast<AbsSharedResultSet>(rdbResultSet_);
+    if (sharedResultSet != nullptr) {
+        return WriteSharedBlock(*sharedResultSet, start, target, columnCount, writer);
+    }
     int errCode = 0;
     int status = 0;
     int row = start;
@@ -99,6 +107,105 @@ int32_t RdbResultSetBridge::WriteBlock(int32_t start, int32_t target, int column
     return target;
 }
 
+int32_t RdbResultSetBridge::WriteSharedBlock(AbsSharedResultSet &resultSet, int32_t start, int32_t target,
+    int columnCount, Writer &writer)
+{
+    int row = start;
+    while (row <= target) {
+        auto block = resultSet.GetBlock();
+        if (block == nullptr) {
+            return row - 1;
+        }
+        // the result set has been moved to the row, so the rows [startPos, lastPos) are filled in the block.
+        int startPos = static_cast<int>(block->GetStartPos());
+        int lastPos = std::min(static_cast<int>(block->GetLastPos()), target + 1);
+        if (row < startPos || row >= lastPos || block->GetColumnNum() < static_cast<uint32_t>(columnCount)) {
+            break;
+        }
+        for (; row < lastPos; row++) {
+            if (writer.AllocRow() != 0) {
+                LOG_ERROR("SharedBlock is full.");
+                return row - 1;
+            }
+            int status = WriteCells(*block, static_cast<uint32_t>(row - startPos), columnCount, writer, row);
+            if (status == E_NOT_SUPPORT && resultSet.GoToRow(row) == E_OK) {
+                writer.FreeLastRow();
+                status = writer.AllocRow() == 0 ? WriteColumn(columnCount, writer, row) : E_ERROR;
+            }
+            if (status != 0) {
+                writer.FreeLastRow();
+                return row - 1;
+            }
+        }
+        if (row <= target && resultSet.GoToRow(row) != E_OK) {
+            return row - 1;
+        }
+    }
+    if (row > target) {
+        return target;
+    }
+    // the block does not match the position, write the rest cell by cell.
+    if (resultSet.GoToRow(row) != E_OK) {
+        return row - 1;
+    }
+    int errCode = E_OK;
+    for (; errCode == E_OK && row <= target; row++) {
+        if (writer.AllocRow() != 0) {
+            LOG_ERROR("SharedBlock is full.");
+            return row - 1;
+        }
+        if (WriteColumn(columnCount, writer, row) != 0) {
+            writer.FreeLastRow();
+            return row - 1;
+        }
+        errCode = resultSet.GoToNextRow();
+    }
+    return target;
+}
+
+int32_t RdbResultSetBridge::WriteCells(
+    AppDataFwk::SharedBlock &block, uint32_t blockRow, int columnCount, Writer &writer, int row)
+{
+    using SharedBlock = AppDataFwk::SharedBlock;
+    int result = 0;
+    for (int i = 0; i < columnCount && result == 0; i++) {
+        auto *cellUnit = block.GetCellUnit(blockRow, static_cast<uint32_t>(i));
+        if (cellUnit == nullptr) {
+            return E_ERROR;
+        }
+        size_t size = 0;
+        switch (cellUnit->type) {
+            case SharedBlock::CELL_UNIT_TYPE_NULL:
+                result = writer.Write(i);
+                break;
+            case SharedBlock::CELL_UNIT_TYPE_INTEGER:
+                result = writer.Write(i, cellUnit->cell.longValue);
+                break;
+            case SharedBlock::CELL_UNIT_TYPE_FLOAT:
+                result = writer.Write(i, cellUnit->cell.doubleValue);
+                break;
+            case SharedBlock::CELL_UNIT_TYPE_STRING: {
+                auto *value = block.GetCellUnitValueString(cellUnit, &size);
+                result = value == nullptr ? E_ERROR : writer.Write(i, value, size);
+                break;
+            }
+            case SharedBlock::CELL_UNIT_TYPE_BLOB: {
+                auto *value = static_cast<const uint8_t *>(block.GetCellUnitValueBlob(cellUnit, &size));
+                // the empty blob is left as it is, the same as WriteBlobData.
+                result = (value == nullptr || size == 0) ? 0 : writer.Write(i, value, size);
+                break;
+            }
+            default:
+                // the assets, floats and bigint are converted by the result set.
+                return E_NOT_SUPPORT;
+        }
+        if (result != 0) {
+            LOG_WARN("Write failed of row: %{public}d, column: %{public}d, type: %{public}d", row, i, cellUnit->type);
+        }
+    }
+    return result;
+}
+
 int32_t RdbResultSetBridge::WriteColumn(int columnCount, Writer &writer, int row)
 {
     int result = 0;
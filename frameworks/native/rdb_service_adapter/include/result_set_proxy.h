@@ -22,7 +22,8 @@
 namespace OHOS::NativeRdb {
 class ResultSetProxy : public IRemoteProxy<IResultSet> {
 public:
-    explicit ResultSetProxy(const sptr<IRemoteObject> &impl);
+    // the capabilities are reported by the stub with the result set, 0 if the stub reports none.
+    explicit ResultSetProxy(const sptr<IRemoteObject> &impl, uint32_t capabilities = 0);
     ~ResultSetProxy();
     int GetColumnCount(int &count) override;
     int GetColumnType(int columnIndex, ColumnType &columnType) override;
@@ -48,6 +49,11 @@ protected:
 private:
     // the max capacity for ipc is 800KB.
     static const size_t MAX_IPC_CAPACITY = 800 * 1024;
+    // the rows requested by one CMD_GET_ROWS, the stub returns less if they are over MAX_IPC_CAPACITY.
+    static constexpr int32_t PREFETCH_ROWS = 128;
+    int MoveTo(int position);
+    int Prefetch(int position);
+    int SyncRemote();
     template<typename... T>
     int Send(uint32_t code, T &...output) const;
 
@@ -55,6 +61,15 @@ private:
     int SendRequest(uint32_t code, MessageParcel &reply, const T &...input) const;
 
     sptr<IRemoteObject> remote_;
+    // the accessors are served from the window if the stub reports CAP_GET_ROWS.
+    bool isPrefetch_ = false;
+    bool isFetched_ = false;
+    // the remote cursor is left behind by the local moves, it is moved before the remote accessor.
+    bool isSynced_ = true;
+    int32_t windowStart_ = 0;
+    int32_t windowRows_ = 0;
+    int32_t windowCols_ = 0;
+    std::vector<ValueObject> window_;
 };
 } // namespace OHOS::NativeRdb
 #endif // NATIVE_RDB_RESULT_SET_PROXY_H
@@ -347,7 +347,12 @@ std::pair<int32_t, std::shared_ptr<RdbServiceProxy::ResultSet>> RdbServiceProxy:
         LOG_ERROR("read remote object is null.");
         return { RDB_ERROR, nullptr };
     }
-    sptr<NativeRdb::ResultSetProxy> instance = new(std::nothrow) NativeRdb::ResultSetProxy(remote);
+    // the older services do not reply the capabilities of the result set.
+    uint32_t capabilities = 0;
+    if (!ITypesUtil::Unmarshal(reply, capabilities)) {
+        capabilities = 0;
+    }
+    sptr<NativeRdb::ResultSetProxy> instance = new(std::nothrow) NativeRdb::ResultSetProxy(remote, capabilities);
     if (instance == nullptr) {
         LOG_ERROR("instance object is null.bundleName:%{public}s, storeName:%{public}s, device:%{public}.6s",
             param.bundleName_.c_str(), SqliteUtils::Anonymous(param.storeName_).c_str(),
@@ -491,7 +496,12 @@ std::pair<int32_t, std::shared_ptr<RdbServiceProxy::ResultSet>> RdbServiceProxy:
             remote != nullptr ? "not" : "");
         return { RDB_ERROR, {} };
     }
-    sptr<NativeRdb::ResultSetProxy> instance = new(std::nothrow) NativeRdb::ResultSetProxy(remote);
+    // the older services do not reply the capabilities of the result set.
+    uint32_t capabilities = 0;
+    if (!ITypesUtil::Unmarshal(reply, capabilities)) {
+        capabilities = 0;
+    }
+    sptr<NativeRdb::ResultSetProxy> instance = new(std::nothrow) NativeRdb::ResultSetProxy(remote, capabilities);
     if (instance == nullptr) {
         LOG_ERROR("instance object is null.bundleName:%{public}s, storeName:%{public}s",
             param.bundleName_.c_str(), SqliteUtils::Anonymous(param.storeName_).c_str());
@@ -15,6 +15,8 @@
 #define LOG_TAG "ResultSetProxy"
 #include "result_set_proxy.h"
 
+#include <algorithm>
+
 #include "itypes_util.h"
 #include "logger.h"
 #include "message_parcel.h"
@@ -24,9 +26,10 @@ namespace OHOS::NativeRdb {
 using namespace OHOS::Rdb;
 using Code = RemoteResultSet::Code;
 
-ResultSetProxy::ResultSetProxy(const sptr<IRemoteObject> &impl) : IRemoteProxy<IResultSet>(impl)
+ResultSetProxy::ResultSetProxy(const sptr<IRemoteObject> &impl, uint32_t capabilities)
+    : IRemoteProxy<IResultSet>(impl), isPrefetch_((capabilities & RemoteResultSet::CAP_GET_ROWS) != 0)
 {
-    LOG_INFO("Init result set proxy.");
+    LOG_INFO("Init result set proxy, capabilities:%{public}u.", capabilities);
     remote_ = Remote();
 }
 
@@ -43,6 +46,23 @@ int ResultSetProxy::GetColumnCount(int &count)
 
 int ResultSetProxy::GetColumnType(int columnIndex, ColumnType &columnType)
 {
+    if (isPrefetch_ && isFetched_) {
+        ValueObject value;
+        auto errCode = Get(columnIndex, value);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        static constexpr ColumnType COLUMN_TYPES[ValueObject::TYPE_MAX] = { ColumnType::TYPE_NULL,
+            ColumnType::TYPE_INTEGER, ColumnType::TYPE_FLOAT, ColumnType::TYPE_STRING, ColumnType::TYPE_INTEGER,
+            ColumnType::TYPE_BLOB, ColumnType::TYPE_ASSET, ColumnType::TYPE_ASSETS, ColumnType::TYPE_FLOAT32_ARRAY,
+            ColumnType::TYPE_BIGINT };
+        auto type = value.GetType();
+        if (type < ValueObject::TYPE_NULL || type >= ValueObject::TYPE_MAX) {
+            return E_INVALID_COLUMN_TYPE;
+        }
+        columnType = COLUMN_TYPES[type];
+        return E_OK;
+    }
     MessageParcel reply;
     int status = SendRequest(Code::CMD_GET_COLUMN_TYPE, reply, columnIndex);
     if (status != E_OK) {
@@ -58,68 +78,118 @@ int ResultSetProxy::GetColumnType(int columnIndex, ColumnType &columnType)
 
 int ResultSetProxy::GetRowCount(int &count)
 {
-    return Send(Code::CMD_GET_ROW_COUNT, count);
+    if (!isPrefetch_) {
+        return Send(Code::CMD_GET_ROW_COUNT, count);
+    }
+    if (rowCount_ == NO_COUNT) {
+        auto errCode = Send(Code::CMD_GET_ROW_COUNT, rowCount_);
+        if (errCode != E_OK) {
+            rowCount_ = NO_COUNT;
+            return errCode;
+        }
+    }
+    count = rowCount_;
+    return E_OK;
 }
 
 int ResultSetProxy::GetRowIndex(int &position) const
 {
+    if (isPrefetch_) {
+        return AbsResultSet::GetRowIndex(position);
+    }
     return Send(Code::CMD_GET_ROW_INDEX, position);
 }
 
 int ResultSetProxy::GoTo(int offset)
 {
+    if (isPrefetch_) {
+        return MoveTo(rowPos_ + offset);
+    }
     MessageParcel reply;
     return SendRequest(Code::CMD_GO_TO, reply, offset);
 }
 
 int ResultSetProxy::GoToRow(int position)
 {
+    if (isPrefetch_) {
+        return MoveTo(position);
+    }
     MessageParcel reply;
     return SendRequest(Code::CMD_GO_TO_ROW, reply, position);
 }
 
 int ResultSetProxy::GoToFirstRow()
 {
-    return Send(Code::CMD_GO_TO_FIRST_ROW);
+    return isPrefetch_ ? MoveTo(0) : Send(Code::CMD_GO_TO_FIRST_ROW);
 }
 
 int ResultSetProxy::GoToLastRow()
 {
+    if (isPrefetch_) {
+        int count = 0;
+        auto errCode = GetRowCount(count);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        return count > 0 ? MoveTo(count - 1) : E_ROW_OUT_RANGE;
+    }
     return Send(Code::CMD_GO_TO_LAST_ROW);
 }
 
 int ResultSetProxy::GoToNextRow()
 {
-    return Send(Code::CMD_GO_TO_NEXT_ROW);
+    return isPrefetch_ ? MoveTo(rowPos_ + 1) : Send(Code::CMD_GO_TO_NEXT_ROW);
 }
 
 int ResultSetProxy::GoToPreviousRow()
 {
-    return Send(Code::CMD_GO_TO_PREV_ROW);
+    return isPrefetch_ ? MoveTo(rowPos_ - 1) : Send(Code::CMD_GO_TO_PREV_ROW);
 }
 
 int ResultSetProxy::IsEnded(bool &result)
 {
+    if (isPrefetch_) {
+        return AbsResultSet::IsEnded(result);
+    }
     return Send(Code::CMD_IS_ENDED_ROW, result);
 }
 
 int ResultSetProxy::IsStarted(bool &result) const
 {
+    if (isPrefetch_) {
+        return AbsResultSet::IsStarted(result);
+    }
     return Send(Code::CMD_IS_STARTED_ROW, result);
 }
 
 int ResultSetProxy::IsAtFirstRow(bool &result) const
 {
+    if (isPrefetch_) {
+        return AbsResultSet::IsAtFirstRow(result);
+    }
     return Send(Code::CMD_IS_AT_FIRST_ROW, result);
 }
 
 int ResultSetProxy::IsAtLastRow(bool &result)
 {
+    if (isPrefetch_) {
+        return AbsResultSet::IsAtLastRow(result);
+    }
     return Send(Code::CMD_IS_AT_LAST_ROW, result);
 }
 
 int ResultSetProxy::Get(int32_t col, ValueObject &value)
 {
+    if (isPrefetch_) {
+        if (rowPos_ < windowStart_ || rowPos_ >= windowStart_ + windowRows_) {
+            return E_ROW_OUT_RANGE;
+        }
+        if (col < 0 || col >= windowCols_) {
+            return E_COLUMN_OUT_RANGE;
+        }
+        value = window_[static_cast<size_t>(rowPos_ - windowStart_) * windowCols_ + col];
+        return E_OK;
+    }
     MessageParcel reply;
     int status = SendRequest(Code::CMD_GET, reply, col);
     if (status != E_OK) {
@@ -134,6 +204,10 @@ int ResultSetProxy::Get(int32_t col, ValueObject &value)
 
 int ResultSetProxy::GetSize(int columnIndex, size_t &size)
 {
+    auto errCode = SyncRemote();
+    if (errCode != E_OK) {
+        return errCode;
+    }
     MessageParcel reply;
     int status = SendRequest(Code::CMD_GET_SIZE, reply, columnIndex);
     if (status != E_OK) {
@@ -149,11 +223,84 @@ int ResultSetProxy::Close()
 {
     auto ret = Send(Code::CMD_CLOSE);
     if (ret == E_OK) {
+        window_.clear();
+        windowRows_ = 0;
         AbsResultSet::Close();
     }
     return ret;
 }
 
+int ResultSetProxy::MoveTo(int position)
+{
+    bool isInWindow = position >= windowStart_ && position < windowStart_ + windowRows_;
+    if (!isInWindow && position >= 0 && (rowCount_ == NO_COUNT || position < rowCount_)) {
+        auto errCode = Prefetch(position);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        isInWindow = windowRows_ > 0;
+    }
+    isSynced_ = false;
+    if (isInWindow) {
+        rowPos_ = position;
+        return E_OK;
+    }
+    rowPos_ = position < 0 ? INIT_POS : rowCount_;
+    return E_ROW_OUT_RANGE;
+}
+
+int ResultSetProxy::Prefetch(int position)
+{
+    MessageParcel reply;
+    auto status = SendRequest(Code::CMD_GET_ROWS, reply, position, PREFETCH_ROWS);
+    int32_t rows = 0;
+    int32_t cols = 0;
+    bool isEnded = false;
+    if (status == E_OK && !ITypesUtil::Unmarshal(reply, rows, cols, isEnded)) {
+        status = E_ERROR;
+    }
+    if (status != E_OK) {
+        return status;
+    }
+    isFetched_ = true;
+    windowStart_ = position;
+    windowRows_ = 0;
+    window_.clear();
+    int count = 0;
+    auto errCode = GetColumnCount(count);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    if (rows < 0 || rows > PREFETCH_ROWS || cols != count) {
+        LOG_ERROR("Invalid rows:%{public}d, cols:%{public}d, count:%{public}d.", rows, cols, count);
+        return E_ERROR;
+    }
+    windowCols_ = cols;
+    window_.resize(static_cast<size_t>(rows) * static_cast<size_t>(cols));
+    for (auto &value : window_) {
+        if (!ITypesUtil::Unmarshal(reply, value.value)) {
+            window_.clear();
+            return E_ERROR;
+        }
+    }
+    windowRows_ = rows;
+    if (isEnded || rows == 0) {
+        rowCount_ = position + rows;
+    }
+    return E_OK;
+}
+
+int ResultSetProxy::SyncRemote()
+{
+    if (!isPrefetch_ || isSynced_) {
+        return E_OK;
+    }
+    MessageParcel reply;
+    auto status = SendRequest(Code::CMD_GO_TO_ROW, reply, rowPos_);
+    isSynced_ = status == E_OK;
+    return status;
+}
+
 std::pair<int, std::vector<std::string>> ResultSetProxy::GetColumnNames()
 {
     std::vector<std::string> colNames;
@@ -105,11 +105,41 @@ public:
      */
     API_EXPORT static int Create(const std::string &name, size_t size, SharedBlock *&outSharedBlock);
 
+    /**
+     * @brief Create a block in the process memory, it moves to the shared memory when it is handed out.
+     */
+    API_EXPORT static int CreateLocal(const std::string &name, size_t size, SharedBlock *&outSharedBlock);
+
     /**
      * @brief Clear current shared block.
      */
     API_EXPORT int Clear() override;
 
+    /**
+     * @brief Clear current shared block so that it can be reused by another result set.
+     */
+    API_EXPORT int Recycle();
+
+    /**
+     * @brief Renames the local block for its new owner, the block in the shared memory keeps its name.
+     */
+    API_EXPORT int Rename(const std::string &name);
+
+    /**
+     * @brief Whether the current shared block is in the shared memory, which may have been mapped by others.
+     */
+    API_EXPORT bool IsShared()
+    {
+        return ashmem_ != nullptr;
+    }
+
+    /**
+     * @brief Moves the local block to the shared memory before it is handed out to others.
+     *
+     * The header and the data pointers obtained from the local block are invalid after it.
+     */
+    API_EXPORT int Promote();
+
     /**
      * @brief Set a shared block column.
      */
@@ -264,14 +294,11 @@ public:
     API_EXPORT size_t SetRawData(const void *rawData, size_t size);
 
     /**
-     * @brief Obtains the fd of shared memory
+     * @brief Obtains the fd of shared memory, -1 if the block is not in the shared memory.
      */
     API_EXPORT int GetFd()
     {
-        if (ashmem_ == nullptr) {
-            return -1;
-        }
-        return ashmem_->GetAshmemFd();
+        return ashmem_ == nullptr ? -1 : ashmem_->GetAshmemFd();
     }
 
     /**
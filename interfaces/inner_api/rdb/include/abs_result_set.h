@@ -180,6 +180,11 @@ public:
     API_EXPORT std::pair<int, std::vector<std::vector<ValueObject>>> GetRowsData(
         int32_t maxCount, int32_t position) override;
 
+    /**
+     * @brief Gets at most maxCount rows from the current row into the columns of the batch.
+     */
+    API_EXPORT std::pair<int, ColumnBatch> FetchColumns(int32_t maxCount) override;
+
     /**
      * @brief Move the cursor to an absolute position.
      *
@@ -351,6 +356,7 @@ protected:
     using Mutex = Lock<std::mutex>;
 
     virtual std::pair<int, std::vector<std::string>> GetColumnNames();
+    virtual int FetchRow(ColumnBatch &batch);
     std::pair<int, bool> IsEnded();
     std::string BuildRowRangeCtx();
 
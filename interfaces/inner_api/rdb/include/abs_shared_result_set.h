@@ -134,8 +134,10 @@ public:
 
 protected:
     int CheckState(int columnIndex);
+    int FetchRow(ColumnBatch &batch) override;
     void ClearBlock();
     void ClosedBlock();
+    std::shared_ptr<AppDataFwk::SharedBlock> ExchangeBlock(std::shared_ptr<AppDataFwk::SharedBlock> block);
     virtual void Finalize();
 
     // The default position of the cursor
@@ -50,6 +50,14 @@ public:
     */
     API_EXPORT CacheResultSet(std::vector<NativeRdb::ValuesBucket> &&valueBuckets, int initPos = 0);
     /**
+    * @brief Constructor.
+    *
+    * @param colNames Indicates the names of the columns.
+    * @param values Indicates the values stored row by row, each row has one value for each column in order.
+    */
+    API_EXPORT CacheResultSet(
+        std::vector<std::string> &&colNames, std::vector<ValueObject> &&values, int initPos = 0);
+    /**
     * @brief Destructor.
     */
     API_EXPORT virtual ~CacheResultSet();
@@ -187,6 +195,11 @@ public:
     */
     API_EXPORT int GetRow(RowEntity &rowEntity) override;
 
+    /**
+    * @brief Gets at most maxCount rows from the current row into the columns of the batch.
+    */
+    API_EXPORT std::pair<int, ColumnBatch> FetchColumns(int32_t maxCount) override;
+
     /**
     * @brief Move the cursor to an absolute position.
     *
@@ -336,6 +349,8 @@ RDB_UTILS_DISABLE_WARNING("-Wc99-designator")
         [ValueObject::TYPE_BIGINT] = ColumnType::TYPE_BIGINT,
     };
 RDB_UTILS_POP_WARNING
+    bool IsIncomplete(int32_t row) const;
+
     int32_t row_;
     mutable std::shared_mutex rwMutex_;
     int32_t maxRow_;
@@ -343,7 +358,10 @@ RDB_UTILS_POP_WARNING
     bool isClosed_ = false;
     std::vector<std::string> colNames_;
     std::vector<int32_t> colTypes_;
-    std::vector<NativeRdb::ValuesBucket> valueBuckets_;
+    // the values of row r are values_[r * maxCol_, (r + 1) * maxCol_), ordered as colNames_.
+    std::vector<ValueObject> values_;
+    // the rows missing some of the columns, empty if none.
+    std::vector<bool> incompleteRows_;
 };
 } // namespace NativeRdb
 } // namespace OHOS
@@ -924,6 +924,20 @@ public:
 
 protected:
     virtual std::string GetLogTableName(const std::string &tableName);
+
+public:
+    /**
+     * @brief Queries data in the database based on SQL statement.
+     *
+     * @param sql Indicates the SQL statement to execute.
+     * @param args Indicates the selection arguments.
+     * @param QueryOptions Options for specifying conditions when query, if the preCount is false, the row count
+     * is calculated when it is required or when the last block has been filled.
+     * The default implementation ignores the options and forwards to QuerySql(sql, args), so the row count is
+     * calculated in advance by the stores that do not override it.
+     */
+    virtual std::shared_ptr<AbsSharedResultSet> QuerySql(const std::string &sql, const Values &args,
+        const QueryOptions &options);
 };
 } // namespace OHOS::NativeRdb
 #endif
@@ -329,6 +329,11 @@ struct ClstAlgoParaT {
 
 using ClusterAlgoFunc = int32_t (*)(ClstAlgoParaT *para);
 
+/**
+ * The name of the bundled k-means cluster algorithm, every vector store registers it when opened.
+ */
+constexpr const char *KMEANS_CLUSTER_ALGO = "rdb_kmeans";
+
 /**
  * Manages relational database configurations.
  */
@@ -765,7 +770,7 @@ public:
             syncMode_ != config.syncMode_ || databaseFileType != config.databaseFileType ||
             journalSize_ != config.journalSize_ || pageSize_ != config.pageSize_ || dbType_ != config.dbType_ ||
             customDir_ != config.customDir_ || pluginLibs_ != config.pluginLibs_ || haMode_ != config.haMode_ ||
-            serverPath_ != config.serverPath_) {
+            asyncReplication_ != config.asyncReplication_ || serverPath_ != config.serverPath_) {
             return false;
         }
 
@@ -876,6 +881,17 @@ public:
 
     void SetHaMode(int32_t haMode);
 
+    /**
+     * @brief Checks whether the slave database of the HA mode is written asynchronously.
+     */
+    bool IsAsyncReplication() const;
+
+    /**
+     * @brief Sets whether the writes are replayed on the slave database in the background instead of
+     * on the commit path. It takes effect only when the binlog is not supported, which is asynchronous already.
+     */
+    void SetAsyncReplication(bool isAsync);
+
     int32_t GetSubUser() const;
  
     void SetSubUser(int32_t subUser);
@@ -928,6 +944,7 @@ private:
     bool autoRekey_ = false;
     mutable bool customEncryptParam_ = false;
     bool enableSemanticIndex_ = false;
+    bool asyncReplication_ = false;
     int32_t journalSize_;
     int32_t pageSize_;
     int32_t readConSize_ = 4;
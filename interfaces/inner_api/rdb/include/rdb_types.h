@@ -102,6 +102,12 @@ struct RdbDfxInfo {
 struct QueryOptions {
     bool preCount = true;
     bool isGotoNextRowReturnLastError = false;
+    // the bytes of the recently stepped rows kept to go back without re-executing the query, 0 to disable.
+    uint32_t windowBudget = 0;
+    // the shared result set fills the next block in the background while the current one is read.
+    bool isPrefetch = false;
+    // the bytes of the filled blocks kept to go back to the visited rows without re-running the query, 0 to disable.
+    uint32_t blockCacheBudget = 0;
 };
 
 enum AssetConflictPolicy {
@@ -72,10 +72,23 @@ public:
         CMD_GET_SIZE,
         /** Indicates the current CMD is CMD_CLOSE.*/
         CMD_CLOSE,
+        /**
+         * Indicates the current CMD is CMD_GET_ROWS, it reads at most maxCount rows from the position.
+         * It is only sent to the stub which reports CAP_GET_ROWS.
+         */
+        CMD_GET_ROWS,
         /** Indicates the current CMD is CMD_MAX.*/
         CMD_MAX
     };
 
+    /**
+     * @brief The capabilities the stub reports with the result set.
+     */
+    enum Capability : uint32_t {
+        /** Indicates the stub supports CMD_GET_ROWS.*/
+        CAP_GET_ROWS = 1 << 0,
+    };
+
     /**
      * @brief Destructor.
      */
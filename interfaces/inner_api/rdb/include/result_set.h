@@ -40,6 +40,57 @@ private:
     std::vector<decltype(values_)::iterator> indexs_;
 };
 
+/**
+ * The rows of a result set stored column by column.
+ * The values of one column are stored in the vector matching its type, the text and blob values are packed into
+ * the arena and the value of row i is arena[offsets[i], offsets[i + 1]). If the rows of one column have different
+ * types, the column is promoted to the widest type in the order of INTEGER, FLOAT, STRING, BLOB. The asset, assets,
+ * float32 array and bigint values are stored as the blobs of their raw data, as the shared block keeps them.
+ */
+struct API_EXPORT ColumnBatch {
+    struct API_EXPORT Column {
+    public:
+        API_EXPORT bool IsNull(int32_t row) const;
+        API_EXPORT void PutNull();
+        API_EXPORT void PutLong(int64_t value);
+        API_EXPORT void PutDouble(double value);
+        API_EXPORT void PutText(ColumnType textType, const void *data, size_t size);
+        API_EXPORT int PutValue(const ValueObject &value);
+
+        ColumnType type = ColumnType::TYPE_NULL;
+        std::vector<int64_t> longs;
+        std::vector<double> doubles;
+        std::vector<size_t> offsets;
+        std::vector<uint8_t> arena;
+        std::vector<uint8_t> nulls;
+
+    private:
+        void PutRawData(const std::vector<uint8_t> &rawData);
+        void Promote(ColumnType target);
+        void Next(bool isNull);
+        int32_t rows_ = 0;
+    };
+
+    int32_t rowCount = 0;
+    std::vector<Column> columns;
+};
+
+/**
+ * A read-only view of a float32 array owned by the result set, like a span.
+ */
+struct Float32View {
+    const float *data = nullptr;
+    size_t size = 0;
+    const float *begin() const
+    {
+        return data;
+    }
+    const float *end() const
+    {
+        return data + size;
+    }
+};
+
 /**
  * The ResultSet class of RDB.
  * Provides methods for accessing a database result set generated by querying the database.
@@ -92,6 +143,25 @@ public:
     virtual void SetLastErrorMsg(const std::string &msg)
     {
     }
+
+    /**
+     * @brief Gets at most maxCount rows from the current row into the columns of the batch.
+     * The cursor stops at the row after the last fetched row.
+     */
+    virtual std::pair<int, ColumnBatch> FetchColumns(int32_t maxCount)
+    {
+        return { E_NOT_SUPPORT, {} };
+    }
+
+    /**
+     * @brief Obtains the float32 array of the column in the current row without copying it.
+     *
+     * The view is valid until the result set moves to another row or is closed.
+     */
+    virtual int GetFloat32View(int32_t index, Float32View &view)
+    {
+        return E_NOT_SUPPORT;
+    }
 };
 
 } // namespace NativeRdb
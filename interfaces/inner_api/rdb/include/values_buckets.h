@@ -16,15 +16,22 @@
 #ifndef NATIVE_RDB_VALUES_BUCKETS_H
 #define NATIVE_RDB_VALUES_BUCKETS_H
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "value_object.h"
 #include "values_bucket.h"
 
 namespace OHOS {
 namespace NativeRdb {
+/**
+ * The rows of the batch share one schema of the fields, and the values of all rows are stored in one arena in the
+ * order of the field index. The value referenced by Get is invalid after the next Put. A copy owns its own fields
+ * and values.
+ */
 class API_EXPORT ValuesBuckets {
 public:
     using FieldsType = std::shared_ptr<std::set<std::string>>;
@@ -36,21 +43,50 @@ public:
     API_EXPORT ValuesBuckets();
     API_EXPORT ValuesBuckets(const std::vector<ValuesBucket> &rows);
     API_EXPORT ValuesBuckets(std::vector<ValuesBucket> &&rows) noexcept;
+    /**
+     * @brief Constructor with the schema, the values put by Put(std::vector<ValueObject> &&) follow its order.
+     */
+    API_EXPORT explicit ValuesBuckets(const std::vector<std::string> &fields);
+    API_EXPORT ValuesBuckets(const ValuesBuckets &other);
+    API_EXPORT ValuesBuckets(ValuesBuckets &&other) noexcept = default;
+    API_EXPORT ValuesBuckets &operator=(const ValuesBuckets &other);
+    API_EXPORT ValuesBuckets &operator=(ValuesBuckets &&other) noexcept = default;
 
     API_EXPORT size_t RowSize() const;
+    API_EXPORT FieldsType GetFields() const;
+    /**
+     * @brief Obtains the fields and the distinct values of all rows, the values are collected on each call.
+     */
     API_EXPORT std::pair<FieldsType, ValuesType> GetFieldsAndValues() const;
+    /**
+     * @brief Visits the values of all rows in place without copying them, the visit stops when the action returns
+     * true.
+     * @return true if the action returns true for any value.
+     */
+    API_EXPORT bool AnyOf(const std::function<bool(const ValueObject &)> &action) const;
 
     API_EXPORT void Reserve(int32_t size);
     API_EXPORT void Put(const ValuesBucket &bucket);
     API_EXPORT void Put(ValuesBucket &&bucket);
+    API_EXPORT int Put(std::vector<ValueObject> &&values);
     API_EXPORT std::pair<int, ValueType> Get(size_t row, const FieldType &field) const;
+    API_EXPORT ValuesBucket GetBucket(size_t row) const;
 
     API_EXPORT void Clear();
 
 private:
+    size_t GetIndex(const std::string &field);
+    size_t AddRow();
+
     FieldsType fields_;
-    ValuesType values_;
-    std::vector<BucketType> buckets_;
+    std::vector<ValueObject> values_;
+    // the index of the field in the row, by the order of its first appearance.
+    std::map<std::string, size_t, std::less<>> indexes_;
+    // the start of each row in values_, the last one is the end of the last row.
+    std::vector<size_t> offsets_;
+    std::vector<bool> exists_;
+    // referenced by Get with the error, it is never written.
+    mutable ValueObject empty_;
 };
 
 } // namespace NativeRdb
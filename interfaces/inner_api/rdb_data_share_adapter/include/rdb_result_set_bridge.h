@@ -22,8 +22,12 @@
 #include "string.h"
 
 namespace OHOS {
+namespace AppDataFwk {
+class SharedBlock;
+}
 namespace NativeRdb {
 class ResultSet;
+class AbsSharedResultSet;
 }
 namespace RdbDataShareAdapter {
 class API_EXPORT RdbResultSetBridge : public DataShare::ResultSetBridge {
@@ -38,7 +42,11 @@ public:
     API_EXPORT int OnGo(int32_t start, int32_t length, Writer &writer) override;
 
 private:
+    using AbsSharedResultSet = NativeRdb::AbsSharedResultSet;
     int32_t WriteBlock(int32_t start, int32_t target, int columnCount, Writer &writer);
+    int32_t WriteSharedBlock(AbsSharedResultSet &resultSet, int32_t start, int32_t target, int columnCount,
+        Writer &writer);
+    int32_t WriteCells(AppDataFwk::SharedBlock &block, uint32_t blockRow, int columnCount, Writer &writer, int row);
     bool WriteBlobData(int column, Writer &writer);
     int32_t WriteColumn(int columnCount, Writer &writer, int row);
     std::shared_ptr<ResultSet> rdbResultSet_;
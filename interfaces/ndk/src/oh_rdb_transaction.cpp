@@ -133,6 +133,7 @@ int OH_RdbTrans_BatchInsert(OH_Rdb_Transaction *trans, const char *table, const
         return RDB_E_INVALID_ARGS;
     }
     ValuesBuckets datas;
+    datas.Reserve(static_cast<int32_t>(rows->rows_.size()));
     for (size_t i = 0; i < rows->rows_.size(); i++) {
         auto valuesBucket = RelationalValuesBucket::GetSelf(const_cast<OH_VBucket *>(rows->rows_[i]));
         if (valuesBucket == nullptr) {
@@ -206,7 +207,8 @@ OH_Cursor *OH_RdbTrans_QuerySql(OH_Rdb_Transaction *trans, const char *sql, cons
     }
     std::vector<ValueObject> datas;
     if (args != nullptr) {
-        for (auto arg : args->values_) {
+        datas.reserve(args->values_.size());
+        for (const auto &arg : args->values_) {
             if (!arg.IsValid()) {
                 continue;
             }
@@ -279,7 +281,8 @@ int OH_RdbTrans_Execute(OH_Rdb_Transaction *trans, const char *sql, const OH_Dat
     }
     std::vector<ValueObject> datas;
     if (args != nullptr) {
-        for (auto arg : args->values_) {
+        datas.reserve(args->values_.size());
+        for (const auto &arg : args->values_) {
             if (!arg.IsValid()) {
                 continue;
             }
@@ -375,6 +378,7 @@ int OH_RdbTrans_BatchInsertWithReturning(OH_Rdb_Transaction *trans, const char *
         return OH_Rdb_ErrCode::RDB_E_INVALID_ARGS;
     }
     ValuesBuckets datas;
+    datas.Reserve(static_cast<int32_t>(rows->rows_.size()));
     for (size_t i = 0; i < rows->rows_.size(); i++) {
         auto valuesBucket = RelationalValuesBucket::GetSelf(const_cast<OH_VBucket *>(rows->rows_[i]));
         if (valuesBucket == nullptr) {
@@ -556,6 +556,7 @@ int OH_Rdb_BatchInsert(OH_Rdb_Store *store, const char *table,
         return OH_Rdb_ErrCode::RDB_E_INVALID_ARGS;
     }
     OHOS::NativeRdb::ValuesBuckets datas;
+    datas.Reserve(static_cast<int32_t>(rows->rows_.size()));
     for (size_t i = 0; i < rows->rows_.size(); i++) {
         auto valuesBucket = RelationalValuesBucket::GetSelf(const_cast<OH_VBucket *>(rows->rows_[i]));
         if (valuesBucket == nullptr) {
@@ -1174,7 +1175,8 @@ int OH_Rdb_ExecuteV2(OH_Rdb_Store *store, const char *sql, const OH_Data_Values
     }
     std::vector<ValueObject> datas;
     if (args != nullptr) {
-        for (auto arg : args->values_) {
+        datas.reserve(args->values_.size());
+        for (const auto &arg : args->values_) {
             if (!arg.IsValid()) {
                 return OH_Rdb_ErrCode::RDB_E_INVALID_ARGS;
             }
@@ -1210,7 +1212,8 @@ OH_Cursor *OH_Rdb_ExecuteQueryV2(OH_Rdb_Store *store, const char *sql, const OH_
     }
     std::vector<ValueObject> datas;
     if (args != nullptr) {
-        for (auto arg : args->values_) {
+        datas.reserve(args->values_.size());
+        for (const auto &arg : args->values_) {
             if (!arg.IsValid()) {
                 LOG_ERROR("args is invalid");
                 return nullptr;
@@ -1588,6 +1591,7 @@ int OH_Rdb_BatchInsertWithReturning(OH_Rdb_Store *store, const char *table, cons
         return OH_Rdb_ErrCode::RDB_E_INVALID_ARGS;
     }
     OHOS::NativeRdb::ValuesBuckets datas;
+    datas.Reserve(static_cast<int32_t>(rows->rows_.size()));
     for (size_t i = 0; i < rows->rows_.size(); i++) {
         auto valuesBucket = RelationalValuesBucket::GetSelf(const_cast<OH_VBucket *>(rows->rows_[i]));
         if (valuesBucket == nullptr) {
@@ -1033,4 +1033,82 @@ HWTEST_F(CacheResultSetTest, GetFloat32ArrayTest_005, TestSize.Level2)
     int index = 0;
     ValueObject::FloatVector vecs;
     EXPECT_EQ(E_ALREADY_CLOSED, cacheResultSet.GetFloat32Array(index, vecs));
-}
\ No newline at end of file
+}
+/* *
+ * @tc.name: FlatValuesTest_001
+ * @tc.desc: the values are laid out by the columns of the first row, the missing cells read as null
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheResultSetTest, FlatValuesTest_001, TestSize.Level2)
+{
+    std::vector<ValuesBucket> valuesBuckets;
+    for (int i = 0; i < 100; i++) {
+        ValuesBucket valuesBucket;
+        valuesBucket.Put("id", i);
+        valuesBucket.Put("name", "name" + std::to_string(i));
+        if (i != 50) {
+            valuesBucket.Put("score", i * 1.5);
+        }
+        valuesBucket.Put("zzz", "extra");
+        valuesBuckets.push_back(std::move(valuesBucket));
+    }
+    CacheResultSet cacheResultSet(std::move(valuesBuckets));
+    int columnCount = 0;
+    EXPECT_EQ(cacheResultSet.GetColumnCount(columnCount), E_OK);
+    ASSERT_EQ(columnCount, 4);
+    int idIndex = -1;
+    int nameIndex = -1;
+    int scoreIndex = -1;
+    EXPECT_EQ(cacheResultSet.GetColumnIndex("id", idIndex), E_OK);
+    EXPECT_EQ(cacheResultSet.GetColumnIndex("name", nameIndex), E_OK);
+    EXPECT_EQ(cacheResultSet.GetColumnIndex("score", scoreIndex), E_OK);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(cacheResultSet.GoToRow(i), E_OK);
+        int64_t id = -1;
+        std::string name;
+        bool isNull = false;
+        EXPECT_EQ(cacheResultSet.GetLong(idIndex, id), E_OK);
+        EXPECT_EQ(cacheResultSet.GetString(nameIndex, name), E_OK);
+        EXPECT_EQ(cacheResultSet.IsColumnNull(scoreIndex, isNull), E_OK);
+        EXPECT_EQ(id, i);
+        EXPECT_EQ(name, "name" + std::to_string(i));
+        EXPECT_EQ(isNull, i == 50);
+        RowEntity rowEntity;
+        EXPECT_EQ(cacheResultSet.GetRow(rowEntity), i == 50 ? E_ERROR : E_OK);
+    }
+    EXPECT_EQ(cacheResultSet.GoToRow(0), E_OK);
+    auto [errCode, batch] = cacheResultSet.FetchColumns(50);
+    EXPECT_EQ(errCode, E_OK);
+    EXPECT_EQ(batch.rowCount, 50);
+    std::tie(errCode, batch) = cacheResultSet.FetchColumns(50);
+    EXPECT_EQ(errCode, E_ERROR);
+}
+/* *
+ * @tc.name: FlatValuesTest_002
+ * @tc.desc: the result set is built from the values stored row by row
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheResultSetTest, FlatValuesTest_002, TestSize.Level2)
+{
+    std::vector<ValueObject> values;
+    for (int i = 0; i < 10; i++) {
+        values.push_back(ValueObject(i));
+        values.push_back(ValueObject("name" + std::to_string(i)));
+    }
+    CacheResultSet cacheResultSet({ "id", "name" }, std::move(values));
+    int rowCount = 0;
+    EXPECT_EQ(cacheResultSet.GetRowCount(rowCount), E_OK);
+    EXPECT_EQ(rowCount, 10);
+    ColumnType columnType;
+    EXPECT_EQ(cacheResultSet.GetColumnType(1, columnType), E_OK);
+    EXPECT_EQ(columnType, ColumnType::TYPE_STRING);
+    EXPECT_EQ(cacheResultSet.GoToRow(9), E_OK);
+    RowEntity rowEntity;
+    EXPECT_EQ(cacheResultSet.GetRow(rowEntity), E_OK);
+    EXPECT_EQ(int(rowEntity.Get("id")), 9);
+    EXPECT_EQ(std::string(rowEntity.Get(1)), "name9");
+
+    CacheResultSet emptyResultSet({ "id" }, {});
+    EXPECT_EQ(emptyResultSet.GetRowCount(rowCount), E_OK);
+    EXPECT_EQ(rowCount, 0);
+}
@@ -0,0 +1,604 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abs_rdb_predicates.h"
+#include "rdb_errno.h"
+#include "rdb_helper.h"
+#include "rdb_open_callback.h"
+#include "rdb_store.h"
+#include "rdb_store_config.h"
+#include "transaction.h"
+#include "values_bucket.h"
+#include "values_buckets.h"
+
+namespace {
+using namespace OHOS::NativeRdb;
+using Clock = std::chrono::steady_clock;
+
+constexpr const char *TABLE_NAME = "bench";
+constexpr const char *CREATE_TABLE_SQL = "CREATE TABLE IF NOT EXISTS bench (id INTEGER PRIMARY KEY AUTOINCREMENT, "
+                                         "name TEXT, age INTEGER, salary REAL, data BLOB)";
+constexpr const char *ASSET_TABLE_NAME = "bench_asset";
+constexpr const char *CREATE_ASSET_TABLE_SQL = "CREATE TABLE IF NOT EXISTS bench_asset (id INTEGER PRIMARY KEY, "
+                                               "attachments ASSETS)";
+constexpr int32_t BLOB_SIZE = 64;
+constexpr int32_t AGE_RANGE = 100;
+constexpr int32_t SCAN_ROWS = 10000;
+constexpr int32_t SCAN_TIMES = 20;
+constexpr int32_t FETCH_COUNT = 1024;
+constexpr int32_t TRANS_ROWS = 10;
+constexpr int32_t ASSET_ROWS = 1000;
+constexpr int32_t ASSETS_PER_ROW = 8;
+constexpr int64_t MAX_BATCH_ROWS = 200000;
+constexpr int32_t BATCH_SIZES[] = { 1, 10, 100, 1000, 10000, 100000 };
+constexpr int32_t READER_COUNTS[] = { 1, 4 };
+constexpr double PERCENT_50 = 0.5;
+constexpr double PERCENT_99 = 0.99;
+constexpr double NS_PER_US = 1000.0;
+constexpr double NS_PER_S = 1000000000.0;
+
+struct Options {
+    std::string dir = "/data/test/";
+    std::string filter;
+    std::string output;
+    int32_t iterations = 1000;
+};
+
+struct Result {
+    std::string name;
+    std::string store;
+    int32_t errCode = E_OK;
+    int64_t items = 0;
+    int64_t elapsed = 0;
+    // the latency of each operation in nanoseconds.
+    std::vector<int64_t> latencies;
+};
+
+class BenchOpenCallback : public RdbOpenCallback {
+public:
+    int OnCreate(RdbStore &store) override
+    {
+        auto errCode = store.ExecuteSql(CREATE_TABLE_SQL);
+        return errCode != E_OK ? errCode : store.ExecuteSql(CREATE_ASSET_TABLE_SQL);
+    }
+    int OnUpgrade(RdbStore &store, int oldVersion, int newVersion) override
+    {
+        return E_OK;
+    }
+};
+
+int64_t Since(Clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+ValuesBucket MakeRow(int64_t index)
+{
+    ValuesBucket row;
+    row.PutString("name", "name_" + std::to_string(index));
+    row.PutInt("age", static_cast<int>(index % AGE_RANGE));
+    row.PutDouble("salary", static_cast<double>(index) * 1.5);
+    row.PutBlob("data", std::vector<uint8_t>(BLOB_SIZE, static_cast<uint8_t>(index)));
+    return row;
+}
+
+ValuesBuckets MakeRows(int64_t begin, int32_t count)
+{
+    ValuesBuckets rows(std::vector<std::string>{ "name", "age", "salary", "data" });
+    rows.Reserve(count);
+    for (int64_t i = begin; i < begin + count; ++i) {
+        rows.Put(std::vector<ValueObject>{ ValueObject("name_" + std::to_string(i)),
+            ValueObject(static_cast<int>(i % AGE_RANGE)), ValueObject(static_cast<double>(i) * 1.5),
+            ValueObject(std::vector<uint8_t>(BLOB_SIZE, static_cast<uint8_t>(i))) });
+    }
+    return rows;
+}
+
+ValueObject::Assets MakeAssets(int64_t index, const std::string &modifyTime)
+{
+    ValueObject::Assets assets(ASSETS_PER_ROW);
+    for (int32_t i = 0; i < ASSETS_PER_ROW; ++i) {
+        auto &asset = assets[i];
+        asset.id = std::to_string(index * ASSETS_PER_ROW + i);
+        asset.name = "IMG_" + asset.id + ".png";
+        asset.uri = "file://data/storage/el2/distributedfiles/photos/" + asset.name;
+        asset.createTime = "2024-07-05 20:37.982158265 +8:00";
+        asset.modifyTime = modifyTime;
+        asset.size = "4194304";
+        asset.hash = modifyTime + "_4194304";
+        asset.path = "photos/" + asset.name;
+        asset.status = ValueObject::Asset::STATUS_NORMAL;
+    }
+    return assets;
+}
+
+int32_t Reset(RdbStore &store, int32_t rows)
+{
+    auto errCode = store.ExecuteSql("DELETE FROM bench");
+    if (errCode != E_OK || rows <= 0) {
+        return errCode;
+    }
+    auto [ret, count] = store.BatchInsert(TABLE_NAME, MakeRows(0, rows));
+    return ret;
+}
+
+/**
+ * Runs func count times, func returns the error code and adds the items it processed.
+ */
+void Measure(Result &result, int32_t count, const std::function<int32_t(int32_t, int64_t &)> &func)
+{
+    result.latencies.reserve(result.latencies.size() + count);
+    auto begin = Clock::now();
+    for (int32_t i = 0; i < count; ++i) {
+        auto start = Clock::now();
+        int64_t items = 0;
+        auto errCode = func(i, items);
+        result.latencies.push_back(Since(start));
+        if (errCode != E_OK) {
+            result.errCode = errCode;
+            break;
+        }
+        result.items += items;
+    }
+    result.elapsed += Since(begin);
+}
+
+int32_t ScanRows(std::shared_ptr<ResultSet> resultSet, int64_t &items)
+{
+    if (resultSet == nullptr) {
+        return E_ERROR;
+    }
+    int errCode = E_OK;
+    while ((errCode = resultSet->GoToNextRow()) == E_OK) {
+        int64_t id = 0;
+        resultSet->GetLong(0, id);
+        items++;
+    }
+    resultSet->Close();
+    return errCode == E_ROW_OUT_RANGE ? E_OK : errCode;
+}
+
+class Benchmark {
+public:
+    explicit Benchmark(const Options &options) : options_(options)
+    {
+    }
+    void Run(const std::string &store, bool isEncrypt);
+    std::string ToJson() const;
+
+private:
+    using Case = std::function<void(RdbStore &, Result &)>;
+    void RunCase(RdbStore &store, const std::string &label, const std::string &name, const Case &bench);
+    void BenchInsert(RdbStore &store, Result &result);
+    void BenchBatchInsert(RdbStore &store, Result &result, int32_t size);
+    void BenchUpdate(RdbStore &store, Result &result);
+    void BenchDelete(RdbStore &store, Result &result);
+    void BenchQuerySql(RdbStore &store, Result &result);
+    void BenchQueryByStep(RdbStore &store, Result &result);
+    void BenchGetRowsData(RdbStore &store, Result &result);
+    void BenchFetchColumns(RdbStore &store, Result &result);
+    void BenchTransaction(RdbStore &store, Result &result);
+    void BenchConcurrentRead(RdbStore &store, Result &result, int32_t readers);
+    void BenchAssetInsert(RdbStore &store, Result &result);
+    void BenchAssetMerge(RdbStore &store, Result &result);
+    void BenchAssetQuery(RdbStore &store, Result &result);
+
+    Options options_;
+    std::vector<Result> results_;
+};
+
+void Benchmark::Run(const std::string &label, bool isEncrypt)
+{
+    RdbStoreConfig config(options_.dir + "rdb_benchmark_" + label + ".db");
+    config.SetEncryptStatus(isEncrypt);
+    RdbHelper::DeleteRdbStore(config);
+    BenchOpenCallback callback;
+    int errCode = E_OK;
+    auto store = RdbHelper::GetRdbStore(config, 1, callback, errCode);
+    if (store == nullptr) {
+        Result result;
+        result.name = "open";
+        result.store = label;
+        result.errCode = errCode == E_OK ? E_ERROR : errCode;
+        results_.push_back(std::move(result));
+        return;
+    }
+    using namespace std::placeholders;
+    RunCase(*store, label, "insert", std::bind(&Benchmark::BenchInsert, this, _1, _2));
+    for (auto size : BATCH_SIZES) {
+        RunCase(*store, label, "batch_insert/" + std::to_string(size),
+            std::bind(&Benchmark::BenchBatchInsert, this, _1, _2, size));
+    }
+    RunCase(*store, label, "update_by_predicates", std::bind(&Benchmark::BenchUpdate, this, _1, _2));
+    RunCase(*store, label, "delete_by_predicates", std::bind(&Benchmark::BenchDelete, this, _1, _2));
+    RunCase(*store, label, "query_sql_scan", std::bind(&Benchmark::BenchQuerySql, this, _1, _2));
+    RunCase(*store, label, "query_by_step_scan", std::bind(&Benchmark::BenchQueryByStep, this, _1, _2));
+    RunCase(*store, label, "get_rows_data", std::bind(&Benchmark::BenchGetRowsData, this, _1, _2));
+    RunCase(*store, label, "fetch_columns", std::bind(&Benchmark::BenchFetchColumns, this, _1, _2));
+    RunCase(*store, label, "transaction", std::bind(&Benchmark::BenchTransaction, this, _1, _2));
+    for (auto readers : READER_COUNTS) {
+        RunCase(*store, label, "concurrent_read/" + std::to_string(readers),
+            std::bind(&Benchmark::BenchConcurrentRead, this, _1, _2, readers));
+    }
+    RunCase(*store, label, "asset_insert", std::bind(&Benchmark::BenchAssetInsert, this, _1, _2));
+    RunCase(*store, label, "asset_merge", std::bind(&Benchmark::BenchAssetMerge, this, _1, _2));
+    RunCase(*store, label, "asset_query", std::bind(&Benchmark::BenchAssetQuery, this, _1, _2));
+    store = nullptr;
+    RdbHelper::DeleteRdbStore(config);
+}
+
+void Benchmark::RunCase(RdbStore &store, const std::string &label, const std::string &name, const Case &bench)
+{
+    if (!options_.filter.empty() && (label + "/" + name).find(options_.filter) == std::string::npos) {
+        return;
+    }
+    Result result;
+    result.name = name;
+    result.store = label;
+    bench(store, result);
+    std::cerr << label << "/" << name << " done, errCode:" << result.errCode << std::endl;
+    results_.push_back(std::move(result));
+}
+
+void Benchmark::BenchInsert(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, 0);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, options_.iterations, [&store](int32_t index, int64_t &items) {
+        auto [errCode, rowId] = store.Insert(TABLE_NAME, MakeRow(index));
+        items = 1;
+        return errCode;
+    });
+}
+
+void Benchmark::BenchBatchInsert(RdbStore &store, Result &result, int32_t size)
+{
+    result.errCode = Reset(store, 0);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    auto times = static_cast<int32_t>(std::max<int64_t>(1, std::min<int64_t>(options_.iterations,
+        MAX_BATCH_ROWS / size)));
+    // the rows are built out of the measured section, only the insert is timed.
+    auto rows = MakeRows(0, size);
+    Measure(result, times, [&store, &rows](int32_t index, int64_t &items) {
+        auto [errCode, count] = store.BatchInsert(TABLE_NAME, rows);
+        items = count;
+        return errCode;
+    });
+}
+
+void Benchmark::BenchUpdate(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, SCAN_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, options_.iterations, [&store](int32_t index, int64_t &items) {
+        AbsRdbPredicates predicates(TABLE_NAME);
+        predicates.EqualTo("age", index % AGE_RANGE);
+        ValuesBucket row;
+        row.PutDouble("salary", static_cast<double>(index));
+        int changed = 0;
+        auto errCode = store.Update(changed, row, predicates);
+        items = changed;
+        return errCode;
+    });
+}
+
+void Benchmark::BenchDelete(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, options_.iterations);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    int64_t first = 0;
+    auto resultSet = store.QuerySql("SELECT MIN(id) FROM bench");
+    if (resultSet == nullptr || resultSet->GoToFirstRow() != E_OK || resultSet->GetLong(0, first) != E_OK) {
+        result.errCode = E_ERROR;
+        return;
+    }
+    resultSet->Close();
+    Measure(result, options_.iterations, [&store, first](int32_t index, int64_t &items) {
+        AbsRdbPredicates predicates(TABLE_NAME);
+        predicates.EqualTo("id", first + index);
+        int deleted = 0;
+        auto errCode = store.Delete(deleted, predicates);
+        items = deleted;
+        return errCode;
+    });
+}
+
+void Benchmark::BenchQuerySql(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, SCAN_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, SCAN_TIMES, [&store](int32_t index, int64_t &items) {
+        return ScanRows(store.QuerySql("SELECT * FROM bench"), items);
+    });
+}
+
+void Benchmark::BenchQueryByStep(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, SCAN_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, SCAN_TIMES, [&store](int32_t index, int64_t &items) {
+        return ScanRows(store.QueryByStep("SELECT * FROM bench"), items);
+    });
+}
+
+void Benchmark::BenchGetRowsData(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, SCAN_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, SCAN_TIMES, [&store](int32_t index, int64_t &items) {
+        auto resultSet = store.QueryByStep("SELECT * FROM bench");
+        if (resultSet == nullptr) {
+            return E_ERROR;
+        }
+        int errCode = E_OK;
+        std::vector<std::vector<ValueObject>> rows;
+        do {
+            std::tie(errCode, rows) = resultSet->GetRowsData(FETCH_COUNT, -1);
+            items += static_cast<int64_t>(rows.size());
+        } while (errCode == E_OK && !rows.empty());
+        resultSet->Close();
+        return errCode;
+    });
+}
+
+void Benchmark::BenchFetchColumns(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, SCAN_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, SCAN_TIMES, [&store](int32_t index, int64_t &items) {
+        auto resultSet = store.QueryByStep("SELECT * FROM bench");
+        if (resultSet == nullptr) {
+            return E_ERROR;
+        }
+        int errCode = E_OK;
+        ColumnBatch batch;
+        do {
+            std::tie(errCode, batch) = resultSet->FetchColumns(FETCH_COUNT);
+            items += batch.rowCount;
+        } while (errCode == E_OK && batch.rowCount > 0);
+        resultSet->Close();
+        return errCode;
+    });
+}
+
+void Benchmark::BenchTransaction(RdbStore &store, Result &result)
+{
+    result.errCode = Reset(store, 0);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, options_.iterations, [&store](int32_t index, int64_t &items) {
+        auto [errCode, trans] = store.CreateTransaction(Transaction::DEFERRED);
+        if (trans == nullptr) {
+            return errCode == E_OK ? E_ERROR : errCode;
+        }
+        for (int32_t i = 0; i < TRANS_ROWS && errCode == E_OK; ++i) {
+            std::tie(errCode, std::ignore) = trans->Insert(TABLE_NAME, MakeRow(index * TRANS_ROWS + i));
+        }
+        if (errCode != E_OK) {
+            trans->Rollback();
+            return errCode;
+        }
+        items = TRANS_ROWS;
+        return trans->Commit();
+    });
+}
+
+void Benchmark::BenchConcurrentRead(RdbStore &store, Result &result, int32_t readers)
+{
+    result.errCode = Reset(store, SCAN_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    std::atomic<bool> isReading = true;
+    std::thread writer([&store, &isReading]() {
+        int64_t index = SCAN_ROWS;
+        while (isReading) {
+            store.Insert(TABLE_NAME, MakeRow(index++));
+        }
+    });
+    std::vector<Result> partials(readers);
+    std::vector<std::thread> threads;
+    auto begin = Clock::now();
+    for (int32_t i = 0; i < readers; ++i) {
+        threads.emplace_back([this, &store, &partial = partials[i]]() {
+            Measure(partial, options_.iterations, [&store](int32_t index, int64_t &items) {
+                std::vector<ValueObject> args{ ValueObject(static_cast<int64_t>(index % SCAN_ROWS + 1)) };
+                return ScanRows(store.QuerySql("SELECT * FROM bench WHERE id = ?", args), items);
+            });
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    isReading = false;
+    writer.join();
+    // the readers run in parallel, the throughput is over the wall time of all of them.
+    result.elapsed = Since(begin);
+    for (auto &partial : partials) {
+        result.errCode = partial.errCode != E_OK ? partial.errCode : result.errCode;
+        result.items += partial.items;
+        result.latencies.insert(result.latencies.end(), partial.latencies.begin(), partial.latencies.end());
+    }
+}
+
+int32_t ResetAssets(RdbStore &store, int32_t rows)
+{
+    auto errCode = store.ExecuteSql("DELETE FROM bench_asset");
+    for (int32_t i = 0; i < rows && errCode == E_OK; ++i) {
+        ValuesBucket row;
+        row.PutInt("id", i);
+        row.Put("attachments", ValueObject(MakeAssets(i, "2024-07-05 20:37.982158265 +8:00")));
+        std::tie(errCode, std::ignore) = store.Insert(ASSET_TABLE_NAME, row);
+    }
+    return errCode;
+}
+
+// The asset cases cover the encoding on the bind path, the decoding on the read path and both in merge_assets.
+void Benchmark::BenchAssetInsert(RdbStore &store, Result &result)
+{
+    result.errCode = ResetAssets(store, 0);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, options_.iterations, [&store](int32_t index, int64_t &items) {
+        ValuesBucket row;
+        row.PutInt("id", index);
+        row.Put("attachments", ValueObject(MakeAssets(index, "2024-07-05 20:37.982158265 +8:00")));
+        auto [errCode, rowId] = store.Insert(ASSET_TABLE_NAME, row);
+        items = ASSETS_PER_ROW;
+        return errCode;
+    });
+}
+
+void Benchmark::BenchAssetMerge(RdbStore &store, Result &result)
+{
+    result.errCode = ResetAssets(store, ASSET_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, options_.iterations, [&store](int32_t index, int64_t &items) {
+        auto id = index % ASSET_ROWS;
+        std::vector<ValueObject> args{ ValueObject(MakeAssets(id, "2024-08-01 10:00.000000000 +8:00")),
+            ValueObject(id) };
+        items = ASSETS_PER_ROW;
+        return store.ExecuteSql("UPDATE bench_asset SET attachments = merge_assets(attachments, ?) WHERE id = ?",
+            args);
+    });
+}
+
+void Benchmark::BenchAssetQuery(RdbStore &store, Result &result)
+{
+    result.errCode = ResetAssets(store, ASSET_ROWS);
+    if (result.errCode != E_OK) {
+        return;
+    }
+    Measure(result, SCAN_TIMES, [&store](int32_t index, int64_t &items) {
+        auto resultSet = store.QueryByStep("SELECT attachments FROM bench_asset");
+        if (resultSet == nullptr) {
+            return E_ERROR;
+        }
+        int errCode = E_OK;
+        while ((errCode = resultSet->GoToNextRow()) == E_OK) {
+            ValueObject::Assets assets;
+            resultSet->GetAssets(0, assets);
+            items += static_cast<int64_t>(assets.size());
+        }
+        resultSet->Close();
+        return errCode == E_ROW_OUT_RANGE ? E_OK : errCode;
+    });
+}
+
+double Percentile(const std::vector<int64_t> &sorted, double percent)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto index = static_cast<size_t>(percent * static_cast<double>(sorted.size() - 1) + 0.5);
+    return static_cast<double>(sorted[std::min(index, sorted.size() - 1)]) / NS_PER_US;
+}
+
+std::string Benchmark::ToJson() const
+{
+    std::ostringstream out;
+    out << "{\n  \"context\": {\"iterations\": " << options_.iterations << ", \"scan_rows\": " << SCAN_ROWS
+        << "},\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results_.size(); ++i) {
+        auto &result = results_[i];
+        auto sorted = result.latencies;
+        std::sort(sorted.begin(), sorted.end());
+        double seconds = static_cast<double>(result.elapsed) / NS_PER_S;
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << result.name << "\", \"store\": \"" << result.store
+            << "\", \"errCode\": " << result.errCode << ", \"ops\": " << sorted.size()
+            << ", \"items\": " << result.items << ", \"p50_us\": " << Percentile(sorted, PERCENT_50)
+            << ", \"p99_us\": " << Percentile(sorted, PERCENT_99)
+            << ", \"ops_per_sec\": " << (seconds > 0 ? static_cast<double>(sorted.size()) / seconds : 0)
+            << ", \"items_per_sec\": " << (seconds > 0 ? static_cast<double>(result.items) / seconds : 0) << "}";
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+bool ParseOptions(int argc, char *argv[], Options &options)
+{
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        std::string value = argv[i + 1];
+        if (key == "--dir") {
+            options.dir = value.back() == '/' ? value : value + "/";
+        } else if (key == "--filter") {
+            options.filter = value;
+        } else if (key == "--output") {
+            options.output = value;
+        } else if (key == "--iterations") {
+            options.iterations = std::max(1, std::atoi(value.c_str()));
+        } else {
+            return false;
+        }
+    }
+    return argc % 2 == 1;
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::cerr << "usage: rdb_benchmark [--dir path] [--filter name] [--iterations count] [--output file]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    Benchmark benchmark(options);
+    benchmark.Run("plain", false);
+    benchmark.Run("encrypt", true);
+    auto json = benchmark.ToJson();
+    if (options.output.empty()) {
+        std::cout << json;
+        return EXIT_SUCCESS;
+    }
+    std::ofstream file(options.output);
+    file << json;
+    return file.good() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
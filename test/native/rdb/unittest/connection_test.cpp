@@ -26,6 +26,7 @@
 #include "rdb_errno.h"
 #include "rdb_helper.h"
 #include "rdb_open_callback.h"
+#include "rdb_perfStat.h"
 #include "rdb_store.h"
 #include "rdb_store_config.h"
 #include "sqlite_connection.h"
@@ -501,4 +502,100 @@ HWTEST_F(ConnectionTest, SetKnowledgeSchema_001, TestSize.Level1)
     schema.tables.push_back(table);
     EXPECT_EQ(conn->SetKnowledgeSchema(schema), E_INVALID_ARGS);
 }
+
+/**
+ * @tc.name: StatementCache_Test_001
+ * @tc.desc: The prepared statement is reused after the previous statement with the same sql released
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConnectionTest, StatementCache_Test_001, TestSize.Level1)
+{
+    std::string dbPath = RDB_TEST_PATH + "statement_cache_test.db";
+    RdbHelper::DeleteRdbStore(dbPath);
+    RdbStoreConfig config(dbPath);
+    auto [errCode, conn] = SqliteConnection::Create(config, true);
+    ASSERT_EQ(errCode, E_OK);
+    auto connection = std::static_pointer_cast<SqliteConnection>(conn);
+    ASSERT_NE(connection->stmtCache_, nullptr);
+    auto hits = connection->stmtCache_->GetHits();
+    auto [storeHits, storeMisses] = OHOS::DistributedRdb::PerfStat::GetStmtCacheCounts(config.GetPath());
+
+    std::string createSql = "CREATE TABLE IF NOT EXISTS test (id INTEGER PRIMARY KEY, name TEXT)";
+    auto [ret, stmt] = conn->CreateStatement(createSql, conn);
+    ASSERT_EQ(ret, E_OK);
+    EXPECT_EQ(stmt->Execute(), E_OK);
+    stmt = nullptr;
+    EXPECT_EQ(connection->stmtCache_->Size(), 0);
+
+    std::string sql = "INSERT INTO test (name) VALUES (?)";
+    std::tie(ret, stmt) = conn->CreateStatement(sql, conn);
+    ASSERT_EQ(ret, E_OK);
+    EXPECT_EQ(stmt->Execute(std::vector<ValueObject>{ ValueObject("zhangsan") }), E_OK);
+    stmt = nullptr;
+    EXPECT_EQ(connection->stmtCache_->Size(), 1);
+
+    std::tie(ret, stmt) = conn->CreateStatement(sql, conn);
+    ASSERT_EQ(ret, E_OK);
+    EXPECT_EQ(connection->stmtCache_->GetHits(), hits + 1);
+    EXPECT_EQ(connection->stmtCache_->Size(), 0);
+    auto counts = OHOS::DistributedRdb::PerfStat::GetStmtCacheCounts(config.GetPath());
+    EXPECT_EQ(counts.first, storeHits + 1);
+    EXPECT_GT(counts.second, storeMisses);
+    EXPECT_EQ(stmt->Execute(std::vector<ValueObject>{ ValueObject("lisi") }), E_OK);
+
+    std::tie(ret, stmt) = conn->CreateStatement("SELECT COUNT(*) FROM test", conn);
+    ASSERT_EQ(ret, E_OK);
+    auto [err, count] = stmt->ExecuteForValue();
+    EXPECT_EQ(err, E_OK);
+    EXPECT_EQ(static_cast<int64_t>(count), 2);
+    stmt = nullptr;
+
+    std::tie(ret, stmt) = conn->CreateStatement("ALTER TABLE test ADD COLUMN age INTEGER", conn);
+    ASSERT_EQ(ret, E_OK);
+    EXPECT_EQ(connection->stmtCache_->Size(), 0);
+    EXPECT_EQ(stmt->Execute(), E_OK);
+    stmt = nullptr;
+    conn = nullptr;
+    connection = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+
+/**
+ * @tc.name: IdleCheckPoint_Test_001
+ * @tc.desc: The checkpoint is deferred on release and done by the idle checkpoint with the wal hook frames
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConnectionTest, IdleCheckPoint_Test_001, TestSize.Level1)
+{
+    std::string dbPath = RDB_TEST_PATH + "idle_checkpoint_test.db";
+    RdbHelper::DeleteRdbStore(dbPath);
+    RdbStoreConfig config(dbPath);
+    auto [errCode, conn] = SqliteConnection::Create(config, true);
+    ASSERT_EQ(errCode, E_OK);
+    auto connection = std::static_pointer_cast<SqliteConnection>(conn);
+    ASSERT_TRUE(connection->walHooked_);
+    ASSERT_NE(connection->walState_, nullptr);
+    ASSERT_GT(connection->autoCheckpoint_, 0);
+
+    std::string createSql = "CREATE TABLE IF NOT EXISTS test (id INTEGER PRIMARY KEY, data BLOB)";
+    auto [ret, stmt] = conn->CreateStatement(createSql, conn);
+    ASSERT_EQ(ret, E_OK);
+    EXPECT_EQ(stmt->Execute(), E_OK);
+    std::vector<uint8_t> blob(1024, 1);
+    auto &state = *connection->walState_;
+    for (int i = 0; i < 10000 && state.frames - state.ckptFrames < connection->autoCheckpoint_; i++) {
+        std::tie(ret, stmt) = conn->CreateStatement("INSERT INTO test (data) VALUES (?)", conn);
+        ASSERT_EQ(ret, E_OK);
+        EXPECT_EQ(stmt->Execute(std::vector<ValueObject>{ ValueObject(blob) }), E_OK);
+    }
+    stmt = nullptr;
+    ASSERT_GE(state.frames - state.ckptFrames, connection->autoCheckpoint_);
+
+    EXPECT_EQ(conn->TryCheckPoint(true), E_INNER_WARNING);
+    EXPECT_EQ(conn->IdleCheckPoint(), E_OK);
+    EXPECT_LT(state.frames - state.ckptFrames, connection->autoCheckpoint_);
+    conn = nullptr;
+    connection = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
 } // namespace Test
\ No newline at end of file
@@ -44,6 +44,31 @@ void RawDataParserTest::TearDown(void)
 {
 }
 
+static ValueObject::Asset MakeAsset(const std::string &id)
+{
+    ValueObject::Asset asset;
+    asset.version = 3;
+    asset.status = ValueObject::Asset::STATUS_NORMAL;
+    asset.id = id;
+    asset.name = "IMG_" + id + ".png";
+    asset.uri = "file://data/args/header/IMG_" + id + ".png";
+    asset.createTime = "2024-07-05 20:37.982158265 +8:00";
+    asset.modifyTime = "2024-07-05 20:37.982158265 +8:00";
+    asset.size = "4194304";
+    asset.hash = "2024-07-05 20:37.982158265 +8:00_4194304";
+    asset.path = "photos/header/IMG_" + id + ".png";
+    asset.extension = "ext_" + id;
+    return asset;
+}
+
+static bool IsSame(const ValueObject::Asset &left, const ValueObject::Asset &right)
+{
+    return left.version == right.version && left.status == right.status && left.expiresTime == right.expiresTime &&
+           left.id == right.id && left.name == right.name && left.uri == right.uri &&
+           left.createTime == right.createTime && left.modifyTime == right.modifyTime && left.size == right.size &&
+           left.hash == right.hash && left.path == right.path && left.extension == right.extension;
+}
+
 /**
  * @tc.name: BigInt_Parser
  * @tc.desc: test insert bigint to rdb store
@@ -283,4 +308,151 @@ HWTEST_F(RawDataParserTest, Asset_Extension_Oversize_Parser, TestSize.Level1)
         ASSERT_TRUE(parsedAsset.extension == asset.extension);
     }
 }
+
+/**
+ * @tc.name: Asset_Binary_Parser
+ * @tc.desc: test the binary asset roundtrip keeps every field and the truncated data is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(RawDataParserTest, Asset_Binary_Parser, TestSize.Level1)
+{
+    auto asset = MakeAsset("100");
+    asset.expiresTime = 1;
+    auto rawData = RawDataParser::PackageBinaryRawData(asset);
+    for (size_t i = 0; i < sizeof(uintptr_t); ++i) {
+        std::vector<uint8_t> noAlign(rawData.size() + i, 0);
+        noAlign.insert(noAlign.begin() + i, rawData.begin(), rawData.end());
+        ValueObject::Asset parsedAsset;
+        ASSERT_EQ(RawDataParser::ParserRawData(noAlign.data() + i, noAlign.size() - i, parsedAsset), rawData.size());
+        ASSERT_TRUE(IsSame(parsedAsset, asset));
+    }
+    ValueObject::Asset parsedAsset;
+    ASSERT_EQ(RawDataParser::ParserRawData(rawData.data(), rawData.size() - 1, parsedAsset), 0);
+}
+
+/**
+ * @tc.name: Asset_Binary_Expires
+ * @tc.desc: test the expired downloading asset is parsed as abnormal in both formats
+ * @tc.type: FUNC
+ */
+HWTEST_F(RawDataParserTest, Asset_Binary_Expires, TestSize.Level1)
+{
+    auto asset = MakeAsset("100");
+    asset.status = ValueObject::Asset::STATUS_DOWNLOADING;
+    asset.expiresTime = 1;
+    ValueObject::Asset binAsset;
+    auto rawData = RawDataParser::PackageBinaryRawData(asset);
+    ASSERT_EQ(RawDataParser::ParserRawData(rawData.data(), rawData.size(), binAsset), rawData.size());
+    ASSERT_EQ(binAsset.status, ValueObject::Asset::STATUS_ABNORMAL);
+    ValueObject::Asset jsonAsset;
+    rawData = RawDataParser::PackageJsonRawData(asset);
+    ASSERT_EQ(RawDataParser::ParserRawData(rawData.data(), rawData.size(), jsonAsset), rawData.size());
+    ASSERT_EQ(jsonAsset.status, ValueObject::Asset::STATUS_ABNORMAL);
+}
+
+/**
+ * @tc.name: Asset_Binary_ForwardCompat
+ * @tc.desc: test the fields appended by a later encoding version are skipped by the payload length
+ * @tc.type: FUNC
+ */
+HWTEST_F(RawDataParserTest, Asset_Binary_ForwardCompat, TestSize.Level1)
+{
+    auto asset = MakeAsset("100");
+    auto rawData = RawDataParser::PackageBinaryRawData(asset);
+    // the encoding version follows the magic, the payload length follows the version.
+    const size_t versionPos = sizeof(uint32_t);
+    const size_t sizePos = versionPos + sizeof(uint16_t);
+    const uint8_t unknown[] = { 1, 2, 3, 4, 5 };
+    rawData[versionPos] = 2;
+    rawData.insert(rawData.end(), std::begin(unknown), std::end(unknown));
+    rawData[sizePos] += sizeof(unknown);
+    std::vector<uint8_t> twice(rawData);
+    twice.insert(twice.end(), rawData.begin(), rawData.end());
+    ValueObject::Asset parsedAsset;
+    ASSERT_EQ(RawDataParser::ParserRawData(twice.data(), twice.size(), parsedAsset), rawData.size());
+    ASSERT_TRUE(IsSame(parsedAsset, asset));
+}
+
+/**
+ * @tc.name: Assets_Binary_Parser
+ * @tc.desc: test the binary assets roundtrip and the empty assets
+ * @tc.type: FUNC
+ */
+HWTEST_F(RawDataParserTest, Assets_Binary_Parser, TestSize.Level1)
+{
+    ValueObject::Assets assets{ MakeAsset("100"), MakeAsset("200"), MakeAsset("300") };
+    auto rawData = RawDataParser::PackageBinaryRawData(assets);
+    for (size_t i = 0; i < sizeof(uintptr_t); ++i) {
+        std::vector<uint8_t> noAlign(rawData.size() + i, 0);
+        noAlign.insert(noAlign.begin() + i, rawData.begin(), rawData.end());
+        ValueObject::Assets parsedAssets;
+        ASSERT_EQ(RawDataParser::ParserRawData(noAlign.data() + i, noAlign.size() - i, parsedAssets), rawData.size());
+        ASSERT_EQ(parsedAssets.size(), assets.size());
+        for (size_t j = 0; j < assets.size(); ++j) {
+            ASSERT_TRUE(IsSame(parsedAssets[j], assets[j]));
+        }
+    }
+    rawData = RawDataParser::PackageBinaryRawData(ValueObject::Assets());
+    ValueObject::Assets parsedAssets;
+    ASSERT_EQ(RawDataParser::ParserRawData(rawData.data(), rawData.size(), parsedAssets), rawData.size());
+    ASSERT_TRUE(parsedAssets.empty());
+}
+
+/**
+ * @tc.name: Assets_Mixed_Version_Parser
+ * @tc.desc: test the payloads of the JSON format are still readable and may be mixed with the binary ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(RawDataParserTest, Assets_Mixed_Version_Parser, TestSize.Level1)
+{
+    ValueObject::Assets assets{ MakeAsset("100"), MakeAsset("200") };
+    auto jsonData = RawDataParser::PackageJsonRawData(assets);
+    auto binData = RawDataParser::PackageBinaryRawData(assets);
+    ASSERT_LT(binData.size(), jsonData.size());
+    ValueObject::Assets jsonAssets;
+    ASSERT_EQ(RawDataParser::ParserRawData(jsonData.data(), jsonData.size(), jsonAssets), jsonData.size());
+    ASSERT_EQ(jsonAssets.size(), assets.size());
+    for (size_t i = 0; i < assets.size(); ++i) {
+        ASSERT_TRUE(IsSame(jsonAssets[i], assets[i]));
+    }
+
+    // an old assets header followed by one record of each format.
+    auto mixed = RawDataParser::PackageJsonRawData(ValueObject::Assets());
+    mixed[sizeof(uint32_t)] = 2;
+    auto first = RawDataParser::PackageJsonRawData(assets[0]);
+    auto second = RawDataParser::PackageBinaryRawData(assets[1]);
+    mixed.insert(mixed.end(), first.begin(), first.end());
+    mixed.insert(mixed.end(), second.begin(), second.end());
+    ValueObject::Assets mixedAssets;
+    ASSERT_EQ(RawDataParser::ParserRawData(mixed.data(), mixed.size(), mixedAssets), mixed.size());
+    ASSERT_EQ(mixedAssets.size(), assets.size());
+    ASSERT_TRUE(IsSame(mixedAssets[0], assets[0]));
+    ASSERT_TRUE(IsSame(mixedAssets[1], assets[1]));
+
+    std::map<std::string, ValueObject::Asset> assetMap;
+    ASSERT_EQ(RawDataParser::ParserRawData(jsonData.data(), jsonData.size(), assetMap), jsonData.size());
+    auto repacked = RawDataParser::PackageRawData(assetMap);
+    ValueObject::Assets parsedAssets;
+    ASSERT_EQ(RawDataParser::ParserRawData(repacked.data(), repacked.size(), parsedAssets), repacked.size());
+    ASSERT_EQ(parsedAssets.size(), assets.size());
+}
+
+/**
+ * @tc.name: Asset_Format_Switch
+ * @tc.desc: test PackageRawData writes the assets in the format set and the binary one only when it is set
+ * @tc.type: FUNC
+ */
+HWTEST_F(RawDataParserTest, Asset_Format_Switch, TestSize.Level1)
+{
+    auto asset = MakeAsset("100");
+    ValueObject::Assets assets{ asset, MakeAsset("200") };
+    RawDataParser::SetAssetFormat(RawDataParser::ASSET_FORMAT_JSON);
+    ASSERT_EQ(RawDataParser::PackageRawData(asset), RawDataParser::PackageJsonRawData(asset));
+    ASSERT_EQ(RawDataParser::PackageRawData(assets), RawDataParser::PackageJsonRawData(assets));
+
+    RawDataParser::SetAssetFormat(RawDataParser::ASSET_FORMAT_BINARY);
+    ASSERT_EQ(RawDataParser::PackageRawData(asset), RawDataParser::PackageBinaryRawData(asset));
+    ASSERT_EQ(RawDataParser::PackageRawData(assets), RawDataParser::PackageBinaryRawData(assets));
+    RawDataParser::SetAssetFormat(RawDataParser::ASSET_FORMAT_JSON);
+}
 } // namespace Test
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rd_cluster_algo.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "grd_error.h"
+#include "grd_type_export.h"
+
+using namespace testing::ext;
+using namespace OHOS::NativeRdb;
+
+namespace Test {
+class RdClusterAlgoTest : public testing::Test {
+public:
+    static void SetUpTestCase(void){};
+    static void TearDownTestCase(void){};
+    void SetUp(){};
+    void TearDown(){};
+
+protected:
+    // 10 dimensions cover both the vectorized loop and the tail.
+    static constexpr uint16_t DIM = 10;
+    static constexpr float BLOB_DISTANCE = 100.0f;
+    static std::vector<float> MakeBlobs(size_t blobs, size_t perBlob, uint32_t seed);
+    static GRD_ClstAlgoParaT MakePara(std::vector<float> &features, std::vector<int32_t> &result);
+};
+
+// The vectors of blob b are around (b * BLOB_DISTANCE, ...) and stored blob by blob.
+std::vector<float> RdClusterAlgoTest::MakeBlobs(size_t blobs, size_t perBlob, uint32_t seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+    std::vector<float> features;
+    for (size_t blob = 0; blob < blobs; ++blob) {
+        for (size_t i = 0; i < perBlob * DIM; ++i) {
+            features.push_back(blob * BLOB_DISTANCE + noise(engine));
+        }
+    }
+    return features;
+}
+
+GRD_ClstAlgoParaT RdClusterAlgoTest::MakePara(std::vector<float> &features, std::vector<int32_t> &result)
+{
+    GRD_ClstAlgoParaT para{};
+    para.featureDim = DIM;
+    para.newFeaturesNum = features.size() / DIM;
+    para.newFeatures = features.data();
+    para.newClusterIdStart = 100;
+    result.assign(para.newFeaturesNum, -1);
+    para.clusterResult = result.data();
+    return para;
+}
+
+/**
+ * @tc.name: RdClusterAlgo_KMeans_001
+ * @tc.desc: test the invalid parameters are rejected and no new vector is a no-op
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdClusterAlgoTest, RdClusterAlgo_KMeans_001, TestSize.Level1)
+{
+    EXPECT_EQ(RdClusterAlgo::KMeans(nullptr), GRD_INVALID_ARGS);
+
+    std::vector<float> features = MakeBlobs(1, 4, 0);
+    std::vector<int32_t> result;
+    GRD_ClstAlgoParaT para = MakePara(features, result);
+    para.featureDim = 0;
+    EXPECT_EQ(RdClusterAlgo::KMeans(&para), GRD_INVALID_ARGS);
+
+    para = MakePara(features, result);
+    para.clusterResult = nullptr;
+    EXPECT_EQ(RdClusterAlgo::KMeans(&para), GRD_INVALID_ARGS);
+
+    para = MakePara(features, result);
+    para.oldFeaturesNum = 1;
+    EXPECT_EQ(RdClusterAlgo::KMeans(&para), GRD_INVALID_ARGS);
+
+    para = MakePara(features, result);
+    para.newFeaturesNum = 0;
+    EXPECT_EQ(RdClusterAlgo::KMeans(&para), GRD_OK);
+    EXPECT_EQ(result, std::vector<int32_t>(4, -1));
+}
+
+/**
+ * @tc.name: RdClusterAlgo_KMeans_002
+ * @tc.desc: test the clusters never mix the separated blobs, the ids are dense and the result is deterministic
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdClusterAlgoTest, RdClusterAlgo_KMeans_002, TestSize.Level1)
+{
+    constexpr size_t blobs = 4;
+    constexpr size_t perBlob = 100;
+    std::vector<float> features = MakeBlobs(blobs, perBlob, 1);
+    std::vector<int32_t> result;
+    GRD_ClstAlgoParaT para = MakePara(features, result);
+    ASSERT_EQ(RdClusterAlgo::KMeans(&para), GRD_OK);
+
+    std::map<int32_t, std::set<size_t>> blobsOfCluster;
+    for (size_t i = 0; i < result.size(); ++i) {
+        blobsOfCluster[result[i]].insert(i / perBlob);
+    }
+    // about sqrt(400) clusters, and each of them is in one blob.
+    EXPECT_GE(blobsOfCluster.size(), blobs);
+    EXPECT_LE(blobsOfCluster.size(), static_cast<size_t>(std::sqrt(blobs * perBlob)));
+    int32_t id = para.newClusterIdStart;
+    for (auto &[cluster, blobSet] : blobsOfCluster) {
+        EXPECT_EQ(cluster, id++);
+        EXPECT_EQ(blobSet.size(), 1u);
+    }
+
+    std::vector<int32_t> again;
+    para = MakePara(features, again);
+    ASSERT_EQ(RdClusterAlgo::KMeans(&para), GRD_OK);
+    EXPECT_EQ(again, result);
+}
+
+/**
+ * @tc.name: RdClusterAlgo_KMeans_003
+ * @tc.desc: test the new vectors join the old clusters nearby and the far ones get a new cluster
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdClusterAlgoTest, RdClusterAlgo_KMeans_003, TestSize.Level1)
+{
+    constexpr size_t oldNum = 4;
+    constexpr size_t perBlob = 3;
+    // the old centers are the blobs 0 to 3, the new vectors are in the blobs 0 to 4.
+    std::vector<float> oldFeatures;
+    for (size_t blob = 0; blob < oldNum; ++blob) {
+        oldFeatures.insert(oldFeatures.end(), DIM, blob * BLOB_DISTANCE);
+    }
+    std::vector<int32_t> oldIds = { 7, 8, 9, 10 };
+    std::vector<int32_t> oldCounts(oldNum, 1);
+    std::vector<float> features = MakeBlobs(oldNum + 1, perBlob, 2);
+    std::vector<int32_t> result;
+    GRD_ClstAlgoParaT para = MakePara(features, result);
+    para.oldFeaturesNum = oldNum;
+    para.oldFeatures = oldFeatures.data();
+    para.oldClstGroupId = oldIds.data();
+    para.oldClstVecNum = oldCounts.data();
+    para.newClusterIdStart = 11;
+    ASSERT_EQ(RdClusterAlgo::KMeans(&para), GRD_OK);
+    for (size_t i = 0; i < result.size(); ++i) {
+        size_t blob = i / perBlob;
+        EXPECT_EQ(result[i], blob < oldNum ? oldIds[blob] : para.newClusterIdStart);
+    }
+}
+} // namespace Test
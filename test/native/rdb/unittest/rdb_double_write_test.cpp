@@ -39,6 +39,7 @@
 #include "sys/types.h"
 #include "rdb_platform.h"
 #include "rdb_store_impl.h"
+#include "slave_replicator.h"
 #include "sqlite_utils.h"
 
 using namespace testing::ext;
@@ -2583,3 +2584,112 @@ HWTEST_F(RdbDoubleWriteTest, ManualTrigger_BackupSuccessReleasesTransConn_011, T
     EXPECT_EQ(ec2, E_OK);
     EXPECT_NE(c2, nullptr);
 }
+
+/**
+ * @tc.name: MainReplica_AsyncReplication_012
+ * @tc.desc: MAIN_REPLICA mode with the async replication: the committed writes reach the slave after Flush,
+ *          the rolled back transaction is not replayed and the interrupt mark is removed once drained.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbDoubleWriteTest, MainReplica_AsyncReplication_012, TestSize.Level1)
+{
+    int errCode = E_OK;
+    RdbStoreConfig config(RdbDoubleWriteTest::DATABASE_NAME);
+    config.SetHaMode(HAMode::MAIN_REPLICA);
+    config.SetAsyncReplication(true);
+    DoubleWriteTestOpenCallback helper;
+    store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    EXPECT_EQ(errCode, E_OK);
+    ASSERT_NE(store, nullptr);
+    auto pool = std::static_pointer_cast<RdbStoreImpl>(store)->GetPool();
+    ASSERT_NE(pool, nullptr);
+    auto replicator = pool->replicator_;
+    ASSERT_NE(replicator, nullptr);
+
+    Insert(1, 10);
+    EXPECT_EQ(store->BeginTransaction(), E_OK);
+    Insert(11, 5);
+    EXPECT_EQ(store->Commit(), E_OK);
+    EXPECT_EQ(store->BeginTransaction(), E_OK);
+    Insert(16, 5);
+    EXPECT_EQ(store->RollBack(), E_OK);
+    // the writes of the transaction connection go to the replicator of the pool too.
+    auto [ret, transaction] = store->CreateTransaction(Transaction::DEFERRED);
+    ASSERT_EQ(ret, E_OK);
+    ASSERT_NE(transaction, nullptr);
+    ValuesBucket row;
+    row.PutInt("id", 16);
+    row.PutString("name", std::string("Tom"));
+    row.PutInt("age", 18);
+    EXPECT_EQ(transaction->Insert("test", row).first, E_OK);
+    EXPECT_EQ(transaction->Commit(), E_OK);
+
+    EXPECT_EQ(replicator->Flush(), E_OK);
+    auto stats = replicator->GetStats();
+    EXPECT_EQ(stats.pendingUnits, 0);
+    EXPECT_EQ(stats.pendingOps, 0);
+    EXPECT_EQ(stats.lagMs, 0);
+    EXPECT_GE(stats.appliedUnits, 12);
+    EXPECT_FALSE(SqliteUtils::IsSlaveInterrupted(RdbDoubleWriteTest::DATABASE_NAME));
+    EXPECT_FALSE(SqliteUtils::IsSlaveInvalid(RdbDoubleWriteTest::DATABASE_NAME));
+
+    RdbStoreConfig slaveConfig(RdbDoubleWriteTest::SLAVE_DATABASE_NAME);
+    DoubleWriteTestOpenCallback slaveHelper;
+    slaveStore = RdbHelper::GetRdbStore(slaveConfig, 1, slaveHelper, errCode);
+    ASSERT_NE(slaveStore, nullptr);
+    CheckNumber(slaveStore, 16);
+}
+
+/**
+ * @tc.name: MainReplica_AsyncReplication_013
+ * @tc.desc: MAIN_REPLICA mode with the async replication: the overlapping transactions and the write of the writer
+ *          between them are replayed as their own units, the slave stays valid.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbDoubleWriteTest, MainReplica_AsyncReplication_013, TestSize.Level1)
+{
+    int errCode = E_OK;
+    RdbStoreConfig config(RdbDoubleWriteTest::DATABASE_NAME);
+    config.SetHaMode(HAMode::MAIN_REPLICA);
+    config.SetAsyncReplication(true);
+    DoubleWriteTestOpenCallback helper;
+    store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    EXPECT_EQ(errCode, E_OK);
+    ASSERT_NE(store, nullptr);
+    auto pool = std::static_pointer_cast<RdbStoreImpl>(store)->GetPool();
+    ASSERT_NE(pool, nullptr);
+    auto replicator = pool->replicator_;
+    ASSERT_NE(replicator, nullptr);
+
+    auto [ret, first] = store->CreateTransaction(Transaction::DEFERRED);
+    ASSERT_EQ(ret, E_OK);
+    ASSERT_NE(first, nullptr);
+    auto [code, second] = store->CreateTransaction(Transaction::DEFERRED);
+    ASSERT_EQ(code, E_OK);
+    ASSERT_NE(second, nullptr);
+    ValuesBucket row;
+    row.PutInt("id", 1);
+    row.PutString("name", std::string("Tom"));
+    row.PutInt("age", 18);
+    EXPECT_EQ(first->Insert("test", row).first, E_OK);
+    EXPECT_EQ(first->Commit(), E_OK);
+    // the autocommit write of the writer while the second transaction is open.
+    Insert(2, 1);
+    row.PutInt("id", 3);
+    EXPECT_EQ(second->Insert("test", row).first, E_OK);
+    EXPECT_EQ(second->Commit(), E_OK);
+
+    EXPECT_EQ(replicator->Flush(), E_OK);
+    auto stats = replicator->GetStats();
+    EXPECT_EQ(stats.pendingUnits, 0);
+    EXPECT_EQ(stats.droppedUnits, 0);
+    EXPECT_GE(stats.appliedUnits, 3);
+    EXPECT_FALSE(SqliteUtils::IsSlaveInterrupted(RdbDoubleWriteTest::DATABASE_NAME));
+    EXPECT_FALSE(SqliteUtils::IsSlaveInvalid(RdbDoubleWriteTest::DATABASE_NAME));
+
+    RdbStoreConfig slaveConfig(RdbDoubleWriteTest::SLAVE_DATABASE_NAME);
+    DoubleWriteTestOpenCallback slaveHelper;
+    slaveStore = RdbHelper::GetRdbStore(slaveConfig, 1, slaveHelper, errCode);
+    ASSERT_NE(slaveStore, nullptr);
+    CheckNumber(slaveStore, 3);
+}
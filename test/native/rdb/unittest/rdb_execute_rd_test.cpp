@@ -135,4 +135,160 @@ HWTEST_P(RdbExecuteRdTest, RdbStore_Execute_006, TestSize.Level1)
     EXPECT_EQ(RdUtils::RdSqlFinalize(stmt), E_OK);
     EXPECT_EQ(RdUtils::RdDbClose(db2, 0), E_OK);
     EXPECT_EQ(RdUtils::RdDbClose(db4, 0), E_OK);
-}
\ No newline at end of file
+}
+
+/**
+ * @tc.name: RdbStore_Execute_Vector_001
+ * @tc.desc: test the float vectors bound in place are stored and read back through the view
+ * @tc.type: FUNC
+ */
+HWTEST_P(RdbExecuteRdTest, RdbStore_Execute_Vector_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbExecuteRdTest::store;
+    auto [ret, obj] = store->Execute("CREATE TABLE IF NOT EXISTS test (id INTEGER PRIMARY KEY, repr floatvector(8));");
+    EXPECT_EQ(ret, E_OK);
+    const std::vector<std::vector<float>> vectors = { { 1.2, 0.3, 3.2, 1.6, 2.5, 3.1, 0.8, 0.4 },
+        { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8 } };
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        // the args are released right after the insert, the store must not keep the bound vector.
+        std::vector<ValueObject> args = { ValueObject(static_cast<int64_t>(i)), ValueObject(vectors[i]) };
+        std::tie(ret, obj) = store->Execute("INSERT INTO test VALUES(?, ?);", args);
+        EXPECT_EQ(ret, E_OK);
+    }
+
+    auto resultSet = store->QueryByStep("SELECT id, repr FROM test ORDER BY id;", std::vector<ValueObject>());
+    ASSERT_NE(resultSet, nullptr);
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        ASSERT_EQ(resultSet->GoToNextRow(), E_OK);
+        Float32View view;
+        ASSERT_EQ(resultSet->GetFloat32View(1, view), E_OK);
+        EXPECT_EQ(std::vector<float>(view.begin(), view.end()), vectors[i]);
+        std::vector<float> copied;
+        EXPECT_EQ(resultSet->GetFloat32Array(1, copied), E_OK);
+        EXPECT_EQ(copied, vectors[i]);
+        EXPECT_EQ(resultSet->GetFloat32View(0, view), E_INVALID_OBJECT_TYPE);
+    }
+    EXPECT_EQ(resultSet->GoToNextRow(), E_ROW_OUT_RANGE);
+    resultSet->Close();
+}
+
+/**
+ * @tc.name: RdbStore_QuerySql_Vector_001
+ * @tc.desc: test the shared result set of the vector store counts the rows and seeks to any of them
+ * @tc.type: FUNC
+ */
+HWTEST_P(RdbExecuteRdTest, RdbStore_QuerySql_Vector_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbExecuteRdTest::store;
+    auto [ret, obj] = store->Execute("CREATE TABLE IF NOT EXISTS test (id INTEGER PRIMARY KEY, repr floatvector(4));");
+    EXPECT_EQ(ret, E_OK);
+    constexpr int rowCount = 100;
+    for (int i = 0; i < rowCount; ++i) {
+        std::vector<float> repr = { i * 1.0f, i * 2.0f, i * 3.0f, i * 4.0f };
+        std::vector<ValueObject> args = { ValueObject(static_cast<int64_t>(i)), ValueObject(repr) };
+        std::tie(ret, obj) = store->Execute("INSERT INTO test VALUES(?, ?);", args);
+        EXPECT_EQ(ret, E_OK);
+    }
+
+    auto resultSet = store->QuerySql("SELECT id, repr FROM test ORDER BY id;", std::vector<ValueObject>());
+    ASSERT_NE(resultSet, nullptr);
+    int count = 0;
+    EXPECT_EQ(resultSet->GetRowCount(count), E_OK);
+    EXPECT_EQ(count, rowCount);
+    for (int row : { 57, 3, rowCount - 1, 0 }) {
+        ASSERT_EQ(resultSet->GoToRow(row), E_OK);
+        int64_t id = -1;
+        EXPECT_EQ(resultSet->GetLong(0, id), E_OK);
+        EXPECT_EQ(id, row);
+        std::vector<float> repr;
+        EXPECT_EQ(resultSet->GetFloat32Array(1, repr), E_OK);
+        std::vector<float> expected = { row * 1.0f, row * 2.0f, row * 3.0f, row * 4.0f };
+        EXPECT_EQ(repr, expected);
+    }
+    EXPECT_EQ(resultSet->GoToRow(rowCount), E_ROW_OUT_RANGE);
+    resultSet->Close();
+}
+
+/**
+ * @tc.name: RdbStore_QuerySql_Vector_002
+ * @tc.desc: test the rows over several blocks are read forward and backward in order
+ * @tc.type: FUNC
+ */
+HWTEST_P(RdbExecuteRdTest, RdbStore_QuerySql_Vector_002, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbExecuteRdTest::store;
+    auto [ret, obj] = store->Execute("CREATE TABLE IF NOT EXISTS test (id INTEGER PRIMARY KEY, repr floatvector(4), "
+                                     "name TEXT);");
+    EXPECT_EQ(ret, E_OK);
+    // the rows of 64KB take several blocks of 2MB.
+    constexpr int rowCount = 100;
+    const std::string name(64 * 1024, 'a');
+    for (int i = 0; i < rowCount; ++i) {
+        std::vector<float> repr = { i * 1.0f, i * 2.0f, i * 3.0f, i * 4.0f };
+        std::vector<ValueObject> args = { ValueObject(static_cast<int64_t>(i)), ValueObject(repr), ValueObject(name) };
+        std::tie(ret, obj) = store->Execute("INSERT INTO test VALUES(?, ?, ?);", args);
+        EXPECT_EQ(ret, E_OK);
+    }
+
+    auto resultSet = store->QuerySql("SELECT id, repr, name FROM test ORDER BY id;", std::vector<ValueObject>());
+    ASSERT_NE(resultSet, nullptr);
+    int64_t id = -1;
+    for (int row = 0; row < rowCount; ++row) {
+        ASSERT_EQ(resultSet->GoToNextRow(), E_OK);
+        EXPECT_EQ(resultSet->GetLong(0, id), E_OK);
+        EXPECT_EQ(id, row);
+    }
+    EXPECT_EQ(resultSet->GoToNextRow(), E_ROW_OUT_RANGE);
+    for (int row = rowCount - 1; row >= 0; row -= 7) {
+        ASSERT_EQ(resultSet->GoToRow(row), E_OK);
+        EXPECT_EQ(resultSet->GetLong(0, id), E_OK);
+        EXPECT_EQ(id, row);
+        std::string value;
+        EXPECT_EQ(resultSet->GetString(2, value), E_OK);
+        EXPECT_EQ(value, name);
+    }
+    int count = 0;
+    EXPECT_EQ(resultSet->GetRowCount(count), E_OK);
+    EXPECT_EQ(count, rowCount);
+    resultSet->Close();
+}
+
+/**
+ * @tc.name: RdbStore_ClusterAlgo_KMeans_001
+ * @tc.desc: test the cluster index is built by the bundled k-means without registering any algo
+ * @tc.type: FUNC
+ */
+HWTEST_P(RdbExecuteRdTest, RdbStore_ClusterAlgo_KMeans_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbExecuteRdTest::store;
+    // the cluster index supports 256 dimensions only.
+    constexpr int dim = 256;
+    constexpr int rowCount = 64;
+    auto [ret, obj] = store->Execute("CREATE TABLE test(id int primary key, repr floatvector(256));");
+    EXPECT_EQ(ret, E_OK);
+    std::string createIndex = "CREATE INDEX ivfcluster_l2_idx ON test USING IVFCLUSTER(repr L2) with (CLUSTER_ALGO='";
+    createIndex.append(KMEANS_CLUSTER_ALGO).append("');");
+    std::tie(ret, obj) = store->Execute(createIndex);
+    EXPECT_EQ(ret, E_OK);
+    for (int i = 0; i < rowCount; ++i) {
+        // two groups far from each other.
+        std::vector<float> repr(dim, (i % 2 == 0) ? 1.0f : 100.0f);
+        repr[i % dim] += 0.5f;
+        std::vector<ValueObject> args = { ValueObject(static_cast<int64_t>(i)), ValueObject(repr) };
+        std::tie(ret, obj) = store->Execute("INSERT INTO test VALUES(?, ?);", args);
+        EXPECT_EQ(ret, E_OK);
+    }
+    std::tie(ret, obj) = store->Execute("PRAGMA CLUSTER_RUN test.ivfcluster_l2_idx;");
+    EXPECT_EQ(ret, E_OK);
+
+    auto resultSet = store->QueryByStep("SELECT id, CLUSTER_ID(repr) FROM test;", std::vector<ValueObject>());
+    ASSERT_NE(resultSet, nullptr);
+    int count = 0;
+    while (resultSet->GoToNextRow() == E_OK) {
+        count++;
+    }
+    EXPECT_EQ(count, rowCount);
+    resultSet->Close();
+    std::tie(ret, obj) = store->Execute("DROP TABLE test;", {}, 0);
+    EXPECT_EQ(ret, E_OK);
+}
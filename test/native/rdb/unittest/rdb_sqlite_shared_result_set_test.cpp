@@ -24,6 +24,7 @@
 #include "rdb_helper.h"
 #include "rdb_open_callback.h"
 #include "shared_block.h"
+#include "shared_block_pool.h"
 #include "sqlite_shared_result_set.h"
 #include "value_object.h"
 
@@ -1719,4 +1720,205 @@ HWTEST_F(RdbSqliteSharedResultSetTest, SqliteSharedResultSet_ErrMsg_001, TestSiz
     EXPECT_NE(errMsg.find("The row index is"), std::string::npos);
     EXPECT_NE(errMsg.find("row count is"), std::string::npos);
     rstSet->Close();
-}
\ No newline at end of file
+}
+
+/**
+ * @tc.name: SqliteSharedResultSet_LazyCount_001
+ * @tc.desc: Query without preCount, the row count is learned from the fill that reaches the end
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, SqliteSharedResultSet_LazyCount_001, TestSize.Level1)
+{
+    GenerateDefaultTable();
+    RdbStore::QueryOptions options{ .preCount = false, .isGotoNextRowReturnLastError = false };
+    auto rstSet = RdbSqliteSharedResultSetTest::store->QuerySql("SELECT * FROM test", {}, options);
+    ASSERT_NE(rstSet, nullptr);
+    auto sharedRstSet = std::static_pointer_cast<SqliteSharedResultSet>(rstSet);
+    EXPECT_EQ(sharedRstSet->rowCount_, -1);
+
+    EXPECT_EQ(rstSet->GoToFirstRow(), E_OK);
+    EXPECT_EQ(sharedRstSet->rowCount_, 3);
+    int id = 0;
+    EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+    EXPECT_EQ(id, 1);
+
+    EXPECT_EQ(rstSet->GoToNextRow(), E_OK);
+    EXPECT_EQ(rstSet->GoToNextRow(), E_OK);
+    EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+    EXPECT_EQ(id, 3);
+    EXPECT_EQ(rstSet->GoToNextRow(), E_ROW_OUT_RANGE);
+    bool isEnded = false;
+    EXPECT_EQ(rstSet->IsEnded(isEnded), E_OK);
+    EXPECT_TRUE(isEnded);
+    rstSet->Close();
+}
+
+/**
+ * @tc.name: SqliteSharedResultSet_LazyCount_002
+ * @tc.desc: Query without preCount, GetRowCount and GoToLastRow calculate the count on demand
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, SqliteSharedResultSet_LazyCount_002, TestSize.Level1)
+{
+    GenerateDefaultTable();
+    RdbStore::QueryOptions options{ .preCount = false, .isGotoNextRowReturnLastError = false };
+    auto rstSet = RdbSqliteSharedResultSetTest::store->QuerySql("SELECT * FROM test", {}, options);
+    ASSERT_NE(rstSet, nullptr);
+    int count = 0;
+    EXPECT_EQ(rstSet->GetRowCount(count), E_OK);
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(rstSet->GoToLastRow(), E_OK);
+    int id = 0;
+    EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+    EXPECT_EQ(id, 3);
+    rstSet->Close();
+
+    rstSet = RdbSqliteSharedResultSetTest::store->QuerySql("SELECT * FROM test", {}, options);
+    ASSERT_NE(rstSet, nullptr);
+    EXPECT_EQ(rstSet->GoToRow(5), E_ROW_OUT_RANGE);
+    EXPECT_EQ(rstSet->GoToLastRow(), E_OK);
+    EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+    EXPECT_EQ(id, 3);
+    rstSet->Close();
+}
+
+/**
+ * @tc.name: SharedBlockPool_001
+ * @tc.desc: The released block is recycled by the pool with the new name, the block handed out is not recycled
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, SharedBlockPool_001, TestSize.Level1)
+{
+    auto &pool = SharedBlockPool::GetInstance();
+    pool.Trim(true);
+    auto stats = pool.GetStats();
+    auto [errCode, block] = pool.Acquire(DATABASE_NAME, SharedBlockPool::MIN_CLASS_SIZE + 1);
+    ASSERT_EQ(errCode, SharedBlockPool::SharedBlock::SHARED_BLOCK_OK);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(block->Size(), SharedBlockPool::MIN_CLASS_SIZE * 2);
+    EXPECT_EQ(block->SetColumnNum(1), SharedBlockPool::SharedBlock::SHARED_BLOCK_OK);
+    auto *address = block.get();
+    block = nullptr;
+    EXPECT_EQ(pool.GetStats().idleBlocks, 1);
+
+    std::string name = DATABASE_NAME + "_reused";
+    std::tie(errCode, block) = pool.Acquire(name, SharedBlockPool::MIN_CLASS_SIZE * 2);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(block.get(), address);
+    EXPECT_EQ(block->Name(), name);
+    EXPECT_EQ(block->GetColumnNum(), 0);
+    EXPECT_EQ(pool.GetStats().hits, stats.hits + 1);
+    EXPECT_EQ(pool.GetStats().usingBlocks, stats.usingBlocks + 1);
+
+    EXPECT_EQ(block->GetFd(), -1);
+    EXPECT_EQ(block->Promote(), SharedBlockPool::SharedBlock::SHARED_BLOCK_OK);
+    EXPECT_GE(block->GetFd(), 0);
+    EXPECT_TRUE(block->IsShared());
+    block = nullptr;
+    EXPECT_EQ(pool.GetStats().idleBlocks, 0);
+    EXPECT_EQ(pool.GetStats().usingBlocks, stats.usingBlocks);
+}
+
+/**
+ * @tc.name: SqliteSharedResultSet_Prefetch_001
+ * @tc.desc: Query with prefetch, the rows crossing the blocks are the same as the query without it
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, SqliteSharedResultSet_Prefetch_001, TestSize.Level1)
+{
+    constexpr int rowCount = 4000;
+    auto &store = RdbSqliteSharedResultSetTest::store;
+    ASSERT_EQ(store->ExecuteSql("CREATE TABLE IF NOT EXISTS prefetch_test (id INTEGER PRIMARY KEY, data TEXT)"),
+        E_OK);
+    // 1KB for each row, the result spans several blocks.
+    ASSERT_EQ(store->ExecuteSql("INSERT INTO prefetch_test WITH RECURSIVE c(x) AS (SELECT 0 UNION ALL SELECT x + 1 "
+                                "FROM c WHERE x < " + std::to_string(rowCount - 1) + ") SELECT x, hex(zeroblob(512)) "
+                                "FROM c"), E_OK);
+    for (bool preCount : { true, false }) {
+        RdbStore::QueryOptions options{ .preCount = preCount, .isGotoNextRowReturnLastError = false,
+            .isPrefetch = true };
+        auto rstSet = store->QuerySql("SELECT id, data FROM prefetch_test ORDER BY id", {}, options);
+        ASSERT_NE(rstSet, nullptr);
+        int expected = 0;
+        while (rstSet->GoToNextRow() == E_OK) {
+            int id = -1;
+            ASSERT_EQ(rstSet->GetInt(0, id), E_OK);
+            ASSERT_EQ(id, expected);
+            expected++;
+        }
+        EXPECT_EQ(expected, rowCount);
+        int count = 0;
+        EXPECT_EQ(rstSet->GetRowCount(count), E_OK);
+        EXPECT_EQ(count, rowCount);
+        EXPECT_EQ(rstSet->GoToFirstRow(), E_OK);
+        int id = -1;
+        EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+        EXPECT_EQ(id, 0);
+        EXPECT_EQ(rstSet->Close(), E_OK);
+    }
+    store->ExecuteSql("DROP TABLE prefetch_test");
+}
+
+/**
+ * @tc.name: SqliteSharedResultSet_BlockCache_001
+ * @tc.desc: Query with the block cache, going back to the visited rows is served without re-running the query
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, SqliteSharedResultSet_BlockCache_001, TestSize.Level1)
+{
+    constexpr int rowCount = 4000;
+    auto &store = RdbSqliteSharedResultSetTest::store;
+    ASSERT_EQ(store->ExecuteSql("CREATE TABLE IF NOT EXISTS cache_test (id INTEGER PRIMARY KEY, data TEXT)"), E_OK);
+    ASSERT_EQ(store->ExecuteSql("INSERT INTO cache_test WITH RECURSIVE c(x) AS (SELECT 0 UNION ALL SELECT x + 1 "
+                                "FROM c WHERE x < " + std::to_string(rowCount - 1) + ") SELECT x, hex(zeroblob(512)) "
+                                "FROM c"), E_OK);
+    RdbStore::QueryOptions options{ .preCount = true, .isGotoNextRowReturnLastError = false,
+        .blockCacheBudget = 8 * 1024 * 1024 };
+    auto rstSet = store->QuerySql("SELECT id, data FROM cache_test ORDER BY id", {}, options);
+    ASSERT_NE(rstSet, nullptr);
+    for (int i = 0; i < 5; i++) {
+        for (int row : { 10, rowCount - 10 }) {
+            EXPECT_EQ(rstSet->GoToRow(row), E_OK);
+            int id = -1;
+            EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+            EXPECT_EQ(id, row);
+        }
+    }
+    auto stats = std::static_pointer_cast<SqliteSharedResultSet>(rstSet)->GetBlockCacheStats();
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.hits, 8);
+    EXPECT_EQ(stats.blocks, 1);
+    EXPECT_EQ(rstSet->Close(), E_OK);
+    store->ExecuteSql("DROP TABLE cache_test");
+}
+
+/**
+ * @tc.name: SharedBlockPool_002
+ * @tc.desc: The block of the local query is not shared, it moves to the shared memory with its rows when handed out
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, SharedBlockPool_002, TestSize.Level1)
+{
+    GenerateDefaultTable();
+    std::vector<std::string> selectionArgs;
+    auto rstSet = RdbSqliteSharedResultSetTest::store->QuerySql("SELECT * FROM test", selectionArgs);
+    ASSERT_NE(rstSet, nullptr);
+    EXPECT_EQ(rstSet->GoToRow(1), E_OK);
+    auto block = std::static_pointer_cast<SqliteSharedResultSet>(rstSet)->GetBlock();
+    ASSERT_NE(block, nullptr);
+    EXPECT_FALSE(block->IsShared());
+    auto *header = block->GetHeader();
+    EXPECT_EQ(block->GetFd(), -1);
+    EXPECT_EQ(block->Promote(), SharedBlockPool::SharedBlock::SHARED_BLOCK_OK);
+    EXPECT_GE(block->GetFd(), 0);
+    EXPECT_TRUE(block->IsShared());
+    EXPECT_NE(block->GetHeader(), header);
+    EXPECT_EQ(block->GetRowNum(), 3u);
+    int id = 0;
+    EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+    EXPECT_EQ(id, 2);
+    EXPECT_EQ(rstSet->GoToRow(2), E_OK);
+    EXPECT_EQ(rstSet->GetInt(0, id), E_OK);
+    EXPECT_EQ(id, 3);
+    rstSet->Close();
+}
@@ -397,5 +397,156 @@ HWTEST_F(RdbStepResultSetTest, RS_ErrMsg_003, TestSize.Level1)
     EXPECT_TRUE(errMsg.empty());
     store->ExecuteSql("DROP TABLE IF EXISTS test");
 }
+
+/**
+ * @tc.name: RS_FetchColumns_001
+ * @tc.desc: Verify FetchColumns returns the typed columns and moves the cursor after the last fetched row.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStepResultSetTest, RS_FetchColumns_001, TestSize.Level1)
+{
+    GenerateDefaultTable();
+    std::string sql = "SELECT id, data1, data2, data3, data4 FROM test ORDER BY id";
+    std::vector<std::shared_ptr<ResultSet>> resultSets = { store->QueryByStep(sql), store->QuerySql(sql) };
+    for (auto &resultSet : resultSets) {
+        ASSERT_NE(resultSet, nullptr);
+        auto [errCode, batch] = resultSet->FetchColumns(2);
+        EXPECT_EQ(errCode, E_OK);
+        EXPECT_EQ(batch.rowCount, 2);
+        ASSERT_EQ(batch.columns.size(), 5);
+        EXPECT_EQ(batch.columns[0].type, ColumnType::TYPE_INTEGER);
+        EXPECT_EQ(batch.columns[0].longs, std::vector<int64_t>({ 1, 2 }));
+        auto &texts = batch.columns[1];
+        EXPECT_EQ(texts.type, ColumnType::TYPE_STRING);
+        ASSERT_EQ(texts.offsets, std::vector<size_t>({ 0, 5, 6 }));
+        EXPECT_EQ(std::string(texts.arena.begin(), texts.arena.end()), "hello2");
+        EXPECT_EQ(batch.columns[2].longs, std::vector<int64_t>({ 10, -5 }));
+        EXPECT_EQ(batch.columns[3].doubles, std::vector<double>({ 1.0, 2.5 }));
+        auto &blobs = batch.columns[4];
+        EXPECT_EQ(blobs.type, ColumnType::TYPE_BLOB);
+        EXPECT_FALSE(blobs.IsNull(0));
+        EXPECT_TRUE(blobs.IsNull(1));
+        EXPECT_EQ(blobs.arena, std::vector<uint8_t>(1, 66));
+
+        int position = -1;
+        EXPECT_EQ(resultSet->GetRowIndex(position), E_OK);
+        EXPECT_EQ(position, 2);
+        std::tie(errCode, batch) = resultSet->FetchColumns(10);
+        EXPECT_EQ(errCode, E_OK);
+        EXPECT_EQ(batch.rowCount, 1);
+        EXPECT_EQ(batch.columns[0].longs, std::vector<int64_t>({ 3 }));
+        std::tie(errCode, batch) = resultSet->FetchColumns(10);
+        EXPECT_EQ(errCode, E_OK);
+        EXPECT_EQ(batch.rowCount, 0);
+        resultSet->Close();
+    }
+}
+
+/**
+ * @tc.name: RS_FetchColumns_002
+ * @tc.desc: Verify the column of FetchColumns is promoted to the widest type of its rows.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStepResultSetTest, RS_FetchColumns_002, TestSize.Level1)
+{
+    auto resultSet = store->QueryByStep("SELECT column1 FROM (VALUES (1), (NULL), (2.5), ('x'))");
+    ASSERT_NE(resultSet, nullptr);
+    auto [errCode, batch] = resultSet->FetchColumns(3);
+    EXPECT_EQ(errCode, E_OK);
+    ASSERT_EQ(batch.rowCount, 3);
+    EXPECT_EQ(batch.columns[0].type, ColumnType::TYPE_FLOAT);
+    EXPECT_EQ(batch.columns[0].doubles, std::vector<double>({ 1.0, 0, 2.5 }));
+    EXPECT_TRUE(batch.columns[0].IsNull(1));
+
+    ColumnBatch::Column column;
+    column.PutLong(1);
+    column.PutNull();
+    column.PutText(ColumnType::TYPE_STRING, "x", 1);
+    EXPECT_EQ(column.type, ColumnType::TYPE_STRING);
+    EXPECT_EQ(column.offsets, std::vector<size_t>({ 0, 1, 1, 2 }));
+    EXPECT_EQ(std::string(column.arena.begin(), column.arena.end()), "1x");
+    EXPECT_TRUE(column.IsNull(1));
+    EXPECT_EQ(column.PutValue(ValueObject(BigInteger(0))), E_OK);
+    EXPECT_EQ(column.type, ColumnType::TYPE_BLOB);
+    EXPECT_EQ(resultSet->FetchColumns(-1).first, E_INVALID_ARGS);
+    resultSet->Close();
+}
+
+/**
+ * @tc.name: RS_FetchColumns_003
+ * @tc.desc: Verify FetchColumns returns the asset column as the blob of its raw data on all result sets.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStepResultSetTest, RS_FetchColumns_003, TestSize.Level1)
+{
+    store->ExecuteSql("DROP TABLE IF EXISTS asset_test");
+    ASSERT_EQ(store->ExecuteSql("CREATE TABLE asset_test (id INTEGER PRIMARY KEY, data ASSET)"), E_OK);
+    AssetValue asset{ .version = 1, .name = "name1", .uri = "uri1", .hash = "hash1", .path = "path1" };
+    ValuesBucket values;
+    values.PutInt("id", 1);
+    values.Put("data", ValueObject(asset));
+    int64_t rowId = -1;
+    ASSERT_EQ(store->Insert(rowId, "asset_test", values), E_OK);
+
+    std::string sql = "SELECT data FROM asset_test";
+    std::vector<std::shared_ptr<ResultSet>> resultSets = { store->QueryByStep(sql), store->QuerySql(sql) };
+    std::vector<std::vector<uint8_t>> arenas;
+    for (auto &resultSet : resultSets) {
+        ASSERT_NE(resultSet, nullptr);
+        auto [errCode, batch] = resultSet->FetchColumns(1);
+        EXPECT_EQ(errCode, E_OK);
+        ASSERT_EQ(batch.rowCount, 1);
+        EXPECT_EQ(batch.columns[0].type, ColumnType::TYPE_BLOB);
+        EXPECT_FALSE(batch.columns[0].arena.empty());
+        arenas.push_back(batch.columns[0].arena);
+        resultSet->Close();
+    }
+    EXPECT_EQ(arenas[0], arenas[1]);
+
+    ColumnBatch::Column column;
+    EXPECT_EQ(column.PutValue(ValueObject(asset)), E_OK);
+    EXPECT_EQ(column.arena, arenas[0]);
+    store->ExecuteSql("DROP TABLE IF EXISTS asset_test");
+}
+
+/**
+ * @tc.name: RS_Window_001
+ * @tc.desc: Verify the rows within the window are read back without re-stepping and the others are re-stepped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStepResultSetTest, RS_Window_001, TestSize.Level1)
+{
+    const std::string sql = "WITH RECURSIVE c(x) AS (SELECT 0 UNION ALL SELECT x + 1 FROM c WHERE x < 99) "
+                            "SELECT x, 'name' || x FROM c";
+    for (uint32_t budget : { 0u, 2048u, 1024u * 1024u }) {
+        RdbStore::QueryOptions options{
+            .preCount = false, .isGotoNextRowReturnLastError = false, .windowBudget = budget };
+        auto resultSet = store->QueryByStep(sql, {}, options);
+        ASSERT_NE(resultSet, nullptr);
+        while (resultSet->GoToNextRow() == E_OK) {
+        }
+        EXPECT_EQ(resultSet->GoToPreviousRow(), E_OK);
+        for (int64_t row = 99; row >= 0; row--) {
+            int64_t x = -1;
+            std::string name;
+            EXPECT_EQ(resultSet->GetLong(0, x), E_OK);
+            EXPECT_EQ(resultSet->GetString(1, name), E_OK);
+            EXPECT_EQ(x, row);
+            EXPECT_EQ(name, "name" + std::to_string(row));
+            EXPECT_EQ(resultSet->GoToPreviousRow(), row == 0 ? E_ROW_OUT_RANGE : E_OK);
+        }
+        EXPECT_EQ(resultSet->GoToRow(97), E_OK);
+        EXPECT_EQ(resultSet->GoTo(2), E_OK);
+        int64_t x = -1;
+        EXPECT_EQ(resultSet->GetLong(0, x), E_OK);
+        EXPECT_EQ(x, 99);
+        EXPECT_EQ(resultSet->GoToNextRow(), E_ROW_OUT_RANGE);
+        EXPECT_EQ(resultSet->GoToPreviousRow(), E_OK);
+        size_t size = 0;
+        EXPECT_EQ(resultSet->GetSize(1, size), E_OK);
+        EXPECT_EQ(size, std::string("name99").size() + 1);
+        resultSet->Close();
+    }
+}
 } // namespace NativeRdb
 } // namespace OHOS
@@ -32,10 +32,12 @@
 #include "rdb_errno.h"
 #include "rdb_helper.h"
 #include "rdb_open_callback.h"
+#include "rdb_sql_utils.h"
 #include "relational_store_delegate.h"
 #include "relational_store_manager.h"
 #include "single_kvstore.h"
 #include "sqlite_connection.h"
+#include "sqlite_sql_builder.h"
 #include "task_executor.h"
 #include "types.h"
 
@@ -297,6 +299,171 @@ HWTEST_F(RdbStoreImplTest, Rdb_BatchInsertTest_002, TestSize.Level2)
     EXPECT_EQ(E_OK, ret);
 }
 
+/* *
+ * @tc.name: Rdb_BatchInsertTest_003
+ * @tc.desc: Normal testCase for BatchInsert, the rows are inserted by the full chunks and the remaining rows.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStoreImplTest, Rdb_BatchInsertTest_003, TestSize.Level1)
+{
+    store_->ExecuteSql("CREATE TABLE IF NOT EXISTS batchChunkTest (id INTEGER PRIMARY KEY, name TEXT, age INTEGER)");
+    ValuesBuckets rows;
+    for (int i = 0; i < 25; i++) {
+        ValuesBucket row;
+        row.Put("id", i);
+        row.Put("name", "name" + std::to_string(i));
+        if (i % 2 == 0) {
+            row.Put("age", i);
+        }
+        rows.Put(row);
+    }
+    // 3 fields and 30 variables at most, 10 rows for each chunk.
+    auto batchSqls = SqliteSqlBuilder::GenerateBatchSqls("batchChunkTest", rows, 30);
+    ASSERT_EQ(batchSqls.size(), 2);
+    EXPECT_EQ(batchSqls[0].rows, 10);
+    EXPECT_EQ(batchSqls[0].times, 2);
+    EXPECT_EQ(batchSqls[1].rows, 5);
+    EXPECT_EQ(batchSqls[1].times, 1);
+    // the fields are bound in the order of age, id, name.
+    std::vector<SqliteSqlBuilder::RefValue> args;
+    SqliteSqlBuilder::FillBatchArgs(rows, 20, 5, args);
+    ASSERT_EQ(args.size(), 15);
+    EXPECT_EQ(int64_t(args[0].get()), 20);
+    EXPECT_EQ(args[3].get().GetType(), ValueObject::TYPE_NULL);
+    EXPECT_EQ(std::string(args[5].get()), "name21");
+
+    auto result = store_->BatchInsert("batchChunkTest", rows);
+    EXPECT_EQ(result.first, E_OK);
+    EXPECT_EQ(result.second, 25);
+    auto resultSet = store_->QuerySql("SELECT age FROM batchChunkTest WHERE id IN (20, 21) ORDER BY id");
+    ASSERT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GoToNextRow(), E_OK);
+    int age = 0;
+    EXPECT_EQ(resultSet->GetInt(0, age), E_OK);
+    EXPECT_EQ(age, 20);
+    EXPECT_EQ(resultSet->GoToNextRow(), E_OK);
+    bool isNull = false;
+    EXPECT_EQ(resultSet->IsColumnNull(0, isNull), E_OK);
+    EXPECT_TRUE(isNull);
+    resultSet->Close();
+    store_->ExecuteSql("DROP TABLE IF EXISTS batchChunkTest");
+}
+
+/* *
+ * @tc.name: Rdb_BatchInsertTest_004
+ * @tc.desc: Normal testCase for BatchInsert, the rows are put by the values of the shared fields.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStoreImplTest, Rdb_BatchInsertTest_004, TestSize.Level1)
+{
+    store_->ExecuteSql("CREATE TABLE IF NOT EXISTS batchFlatTest (id INTEGER PRIMARY KEY, name TEXT, age INTEGER)");
+    ValuesBuckets rows(std::vector<std::string>{ "id", "name", "age" });
+    rows.Reserve(3);
+    EXPECT_EQ(rows.Put({ ValueObject(1), ValueObject("a"), ValueObject(10) }), E_OK);
+    EXPECT_EQ(rows.Put({ ValueObject(2), ValueObject("b") }), E_OK);
+    EXPECT_EQ(rows.Put({ ValueObject(3), ValueObject("c"), ValueObject(30), ValueObject(0) }), E_INVALID_ARGS);
+    ValuesBucket row;
+    row.Put("age", 30);
+    row.Put("id", 3);
+    rows.Put(row);
+    ASSERT_EQ(rows.RowSize(), 3);
+
+    std::string age = "age";
+    EXPECT_EQ(rows.Get(1, age).first, E_INVALID_ARGS);
+    auto [errCode, value] = rows.Get(2, age);
+    EXPECT_EQ(errCode, E_OK);
+    EXPECT_EQ(int64_t(value.get()), 30);
+    auto bucket = rows.GetBucket(0);
+    EXPECT_EQ(bucket.values_.size(), 3);
+    EXPECT_EQ(std::string(bucket.values_["name"]), "a");
+
+    auto result = store_->BatchInsert("batchFlatTest", rows);
+    EXPECT_EQ(result.first, E_OK);
+    EXPECT_EQ(result.second, 3);
+    auto resultSet = store_->QuerySql("SELECT name FROM batchFlatTest WHERE id = 3");
+    ASSERT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GoToNextRow(), E_OK);
+    bool isNull = false;
+    EXPECT_EQ(resultSet->IsColumnNull(0, isNull), E_OK);
+    EXPECT_TRUE(isNull);
+    resultSet->Close();
+    store_->ExecuteSql("DROP TABLE IF EXISTS batchFlatTest");
+}
+
+/* *
+ * @tc.name: Rdb_BatchInsertTest_005
+ * @tc.desc: Normal testCase for ValuesBuckets, a copy owns its rows and the missing value is an error.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStoreImplTest, Rdb_BatchInsertTest_005, TestSize.Level1)
+{
+    ValuesBuckets rows;
+    ValuesBucket row;
+    row.Put("id", 1);
+    row.Put("name", "a");
+    rows.Put(row);
+
+    ValuesBuckets copy = rows;
+    copy.Clear();
+    ValuesBucket other;
+    other.Put("age", 2);
+    copy.Put(other);
+    ValuesBuckets assigned;
+    assigned = rows;
+    assigned.Put(row);
+
+    std::string name = "name";
+    ASSERT_EQ(rows.RowSize(), 1);
+    EXPECT_EQ(rows.GetFields()->size(), 2);
+    auto [errCode, value] = rows.Get(0, name);
+    EXPECT_EQ(errCode, E_OK);
+    EXPECT_EQ(std::string(value.get()), "a");
+    EXPECT_EQ(rows.Get(1, name).first, E_INVALID_ARGS);
+    EXPECT_EQ(copy.Get(0, name).first, E_INVALID_ARGS);
+    EXPECT_EQ(assigned.RowSize(), 2);
+    auto [fields, values] = assigned.GetFieldsAndValues();
+    EXPECT_EQ(fields->size(), 2);
+    EXPECT_EQ(values->size(), 2);
+}
+
+/* *
+ * @tc.name: Rdb_BatchInsertTest_006
+ * @tc.desc: Normal testCase for ValuesBuckets, AnyOf visits the values of all rows and stops at the first match.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStoreImplTest, Rdb_BatchInsertTest_006, TestSize.Level1)
+{
+    ValuesBuckets rows;
+    for (int i = 0; i < 3; ++i) {
+        ValuesBucket row;
+        row.Put("id", i);
+        rows.Put(row);
+    }
+    ValuesBucket named;
+    named.Put("name", "a");
+    rows.Put(named);
+
+    int visited = 0;
+    EXPECT_FALSE(rows.AnyOf([&visited](const ValueObject &value) {
+        visited++;
+        return false;
+    }));
+    EXPECT_EQ(visited, 4);
+    visited = 0;
+    EXPECT_TRUE(rows.AnyOf([&visited](const ValueObject &value) {
+        visited++;
+        return value.GetType() == ValueObject::TYPE_INT && static_cast<int>(value) == 1;
+    }));
+    EXPECT_EQ(visited, 2);
+
+    ValueObject::Assets assets = { AssetValue{ .name = "asset" }, AssetValue{ .name = "asset" } };
+    EXPECT_FALSE(RdbSqlUtils::HasDuplicateAssets(rows));
+    ValuesBucket duplicated;
+    duplicated.Put("assets", assets);
+    rows.Put(duplicated);
+    EXPECT_TRUE(RdbSqlUtils::HasDuplicateAssets(rows));
+}
+
 /* *
  * @tc.name: Rd_BatchInsertTest_001
  * @tc.desc: Abnormal testCase for BatchInsert, the statement is reset..
@@ -3082,3 +3249,85 @@ HWTEST_F(RdbStoreImplTest, IsNotifyService_Test_001, TestSize.Level1)
     EXPECT_FALSE(RdbStoreImpl::IsNotifyService(changedData, notifyConfig));
 }
 
+/* *
+ * @tc.name: Rdb_ConnectionPoolTest_Slot_001
+ * @tc.desc: The released reader is kept in the slot of the thread and acquired again without the lock
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStoreImplTest, Rdb_ConnectionPoolTest_Slot_001, TestSize.Level2)
+{
+    const std::string DATABASE_NAME = RDB_TEST_PATH + "ConnectionSlotTest.db";
+    int errCode = E_OK;
+    RdbStoreConfig config(DATABASE_NAME);
+    config.SetReadConSize(2);
+    config.SetStorageMode(StorageMode::MODE_DISK);
+    std::shared_ptr<RdbStoreConfig> configHolder = std::make_shared<RdbStoreConfig>(config);
+    auto connectionPool = ConnectionPool::Create(configHolder, *configHolder, errCode);
+    ASSERT_NE(nullptr, connectionPool);
+    EXPECT_EQ(E_OK, errCode);
+    EXPECT_EQ(connectionPool->readers_.slotNum_, 2);
+
+    auto connection = connectionPool->AcquireConnection(true);
+    ASSERT_NE(nullptr, connection);
+    auto *reader = connection.get();
+    connection = nullptr;
+    EXPECT_EQ(connectionPool->readers_.slotted_, 1);
+
+    connection = connectionPool->AcquireConnection(true);
+    ASSERT_NE(nullptr, connection);
+    EXPECT_EQ(connection.get(), reader);
+    EXPECT_EQ(connectionPool->readers_.slotted_, 0);
+    connection = nullptr;
+
+    // the locked paths see the idle nodes in the slots.
+    EXPECT_TRUE(connectionPool->readers_.IsFull());
+    EXPECT_EQ(connectionPool->readers_.slotted_, 0);
+    EXPECT_EQ(connectionPool->readers_.count_, 2);
+    connectionPool->CloseAllConnections();
+    connectionPool = nullptr;
+    RdbHelper::DeleteRdbStore(DATABASE_NAME);
+}
+
+
+/* *
+ * @tc.name: Rdb_VectorDistanceTest_001
+ * @tc.desc: The distance functions accept the float vectors and the plain float blobs
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStoreImplTest, Rdb_VectorDistanceTest_001, TestSize.Level2)
+{
+    store_->ExecuteSql("CREATE TABLE IF NOT EXISTS vectors (id INTEGER PRIMARY KEY, repr floatvector(9), raw BLOB)");
+    // 9 floats cover both the vectorized loop and the tail.
+    std::vector<float> repr = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    std::vector<float> query = { 1, 2, 3, 4, 5, 6, 7, 8, 0 };
+    std::vector<uint8_t> raw(reinterpret_cast<uint8_t *>(repr.data()),
+        reinterpret_cast<uint8_t *>(repr.data()) + repr.size() * sizeof(float));
+    ValuesBucket values;
+    values.Put("id", 1);
+    values.Put("repr", repr);
+    values.Put("raw", raw);
+    int64_t rowId = -1;
+    EXPECT_EQ(store_->Insert(rowId, "vectors", values), E_OK);
+
+    auto resultSet = store_->QuerySql("SELECT l2_distance(repr, ?), inner_product(raw, ?), cosine_distance(repr, raw) "
+                                      "FROM vectors",
+        std::vector<ValueObject>{ ValueObject(query), ValueObject(query) });
+    ASSERT_NE(resultSet, nullptr);
+    ASSERT_EQ(resultSet->GoToFirstRow(), E_OK);
+    double distance = -1;
+    EXPECT_EQ(resultSet->GetDouble(0, distance), E_OK);
+    EXPECT_DOUBLE_EQ(distance, 9.0);
+    EXPECT_EQ(resultSet->GetDouble(1, distance), E_OK);
+    EXPECT_DOUBLE_EQ(distance, 204.0);
+    EXPECT_EQ(resultSet->GetDouble(2, distance), E_OK);
+    EXPECT_NEAR(distance, 0.0, 1e-6);
+    resultSet->Close();
+
+    // the vectors of different dimensions are rejected.
+    resultSet = store_->QuerySql("SELECT l2_distance(repr, ?) FROM vectors",
+        std::vector<ValueObject>{ ValueObject(std::vector<float>{ 1, 2, 3 }) });
+    ASSERT_NE(resultSet, nullptr);
+    EXPECT_NE(resultSet->GoToFirstRow(), E_OK);
+    resultSet->Close();
+    store_->ExecuteSql("DROP TABLE IF EXISTS vectors");
+}
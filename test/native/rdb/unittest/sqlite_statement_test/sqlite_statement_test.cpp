@@ -303,4 +303,176 @@ HWTEST_F(RdbSqliteStatementTest, S_ErrMsg_004, TestSize.Level0)
 
     conn = nullptr;
     RdbHelper::DeleteRdbStore(dbPath);
-}
\ No newline at end of file
+}
+/**
+ * @tc.name: StaticBind_001
+ * @tc.desc: the args bound without copy are released by the statement before they go away
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteStatementTest, StaticBind_001, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "StaticBind_001.db";
+    RdbHelper::DeleteRdbStore(dbPath);
+    SqliteGlobalConfig::InitSqliteGlobalConfig();
+    RdbStoreConfig config(dbPath);
+    auto [errCode, conn] = Connection::Create(config, true);
+    ASSERT_EQ(errCode, E_OK);
+    ASSERT_NE(conn, nullptr);
+    auto [createErr, create] = conn->CreateStatement("CREATE TABLE test(id INTEGER, name TEXT, data BLOB)", conn);
+    ASSERT_NE(create, nullptr);
+    EXPECT_EQ(create->Execute(), E_OK);
+
+    auto [insertErr, insert] = conn->CreateStatement("INSERT INTO test VALUES(?, ?, ?)", conn);
+    ASSERT_NE(insert, nullptr);
+    for (int64_t id = 0; id < 2; id++) {
+        std::vector<ValueObject> args = { ValueObject(id), ValueObject(std::string(4096, 'a' + id)),
+            ValueObject(std::vector<uint8_t>(8192, static_cast<uint8_t>(id + 1))) };
+        EXPECT_EQ(insert->Execute(args), E_OK);
+    }
+
+    auto [queryErr, query] = conn->CreateStatement("SELECT id, name, data FROM test WHERE id >= ? ORDER BY id", conn);
+    ASSERT_NE(query, nullptr);
+    std::vector<ValueObject> args = { ValueObject(int64_t(0)) };
+    auto [rowsErr, rows] = query->ExecuteForRows(args, 10);
+    EXPECT_EQ(rowsErr, E_OK);
+    ASSERT_EQ(rows.size(), 2);
+    for (int64_t id = 0; id < 2; id++) {
+        ValueObject name;
+        ValueObject data;
+        EXPECT_TRUE(rows[id].GetObject("name", name));
+        EXPECT_TRUE(rows[id].GetObject("data", data));
+        EXPECT_EQ(std::string(name), std::string(4096, 'a' + id));
+        EXPECT_EQ(std::vector<uint8_t>(data), std::vector<uint8_t>(8192, static_cast<uint8_t>(id + 1)));
+    }
+
+    // the args of Bind are held by the caller while stepping, the missing ones are bound as null.
+    auto [selectErr, select] = conn->CreateStatement("SELECT ?, ?", conn);
+    ASSERT_NE(select, nullptr);
+    std::vector<ValueObject> bindArgs = { ValueObject(std::string(4096, 'z')) };
+    EXPECT_EQ(select->Bind(bindArgs), E_OK);
+    EXPECT_EQ(select->Step(), E_OK);
+    EXPECT_EQ(std::string(select->GetColumn(0).second), std::string(4096, 'z'));
+    EXPECT_EQ(select->GetColumn(1).second.GetType(), ValueObject::TYPE_NULL);
+
+    create = nullptr;
+    insert = nullptr;
+    query = nullptr;
+    select = nullptr;
+    conn = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+/**
+ * @tc.name: ExecuteForReturning_001
+ * @tc.desc: the returned rows are stored by the columns sorted by name and all the rows are changed over maxCount
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteStatementTest, ExecuteForReturning_001, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "ExecuteForReturning_001.db";
+    RdbHelper::DeleteRdbStore(dbPath);
+    SqliteGlobalConfig::InitSqliteGlobalConfig();
+    RdbStoreConfig config(dbPath);
+    auto [errCode, conn] = Connection::Create(config, true);
+    ASSERT_EQ(errCode, E_OK);
+    ASSERT_NE(conn, nullptr);
+    auto [createErr, create] = conn->CreateStatement("CREATE TABLE test(id INTEGER, name TEXT, data BLOB)", conn);
+    ASSERT_NE(create, nullptr);
+    EXPECT_EQ(create->Execute(), E_OK);
+    auto [insertErr, insert] = conn->CreateStatement("INSERT INTO test VALUES(?, ?, ?)", conn);
+    ASSERT_NE(insert, nullptr);
+    for (int64_t id = 0; id < 5; id++) {
+        std::vector<ValueObject> args = { ValueObject(id), ValueObject(std::to_string(id)),
+            ValueObject(std::vector<uint8_t>(3, static_cast<uint8_t>(id))) };
+        EXPECT_EQ(insert->Execute(args), E_OK);
+    }
+
+    auto [updateErr, update] =
+        conn->CreateStatement("UPDATE test SET name = ? RETURNING name, data, id, id + 100 AS id", conn);
+    ASSERT_NE(update, nullptr);
+    std::vector<ValueObject> args = { ValueObject(std::string("new")) };
+    auto [rowsErr, rows] = update->ExecuteForReturning(args, 2);
+    EXPECT_EQ(rowsErr, E_OK);
+    EXPECT_EQ(update->Changes(), 5);
+    ASSERT_EQ(rows.columns, std::vector<std::string>({ "data", "id", "name" }));
+    ASSERT_EQ(rows.values.size(), 6);
+    for (int64_t row = 0; row < 2; row++) {
+        auto *values = &rows.values[row * rows.columns.size()];
+        EXPECT_EQ(std::vector<uint8_t>(values[0]), std::vector<uint8_t>(3, static_cast<uint8_t>(row)));
+        EXPECT_EQ(int64_t(values[1]), row + 100);
+        EXPECT_EQ(std::string(values[2]), "new");
+    }
+
+    auto [countErr, count] = conn->CreateStatement("SELECT COUNT(*) FROM test WHERE name = 'new'", conn);
+    ASSERT_NE(count, nullptr);
+    EXPECT_EQ(int64_t(count->ExecuteForValue().second), 5);
+
+    auto [bucketsErr, buckets] = update->ExecuteForRows(args, 10);
+    EXPECT_EQ(bucketsErr, E_OK);
+    ASSERT_EQ(buckets.size(), 5);
+    ValueObject id;
+    EXPECT_TRUE(buckets[4].GetObject("id", id));
+    EXPECT_EQ(int64_t(id), 104);
+
+    create = nullptr;
+    insert = nullptr;
+    update = nullptr;
+    count = nullptr;
+    conn = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+
+/**
+ * @tc.name: ExecuteForReturning_002
+ * @tc.desc: the zero length blob is returned as the empty blob and the corrupt asset fails the returning rows
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbSqliteStatementTest, ExecuteForReturning_002, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "ExecuteForReturning_002.db";
+    RdbHelper::DeleteRdbStore(dbPath);
+    SqliteGlobalConfig::InitSqliteGlobalConfig();
+    RdbStoreConfig config(dbPath);
+    auto [errCode, conn] = Connection::Create(config, true);
+    ASSERT_EQ(errCode, E_OK);
+    ASSERT_NE(conn, nullptr);
+    auto [createErr, create] = conn->CreateStatement("CREATE TABLE test(id INTEGER, data ASSET, raw BLOB)", conn);
+    ASSERT_NE(create, nullptr);
+    EXPECT_EQ(create->Execute(), E_OK);
+    auto [insertErr, insert] = conn->CreateStatement("INSERT INTO test VALUES(1, X'0102', X'')", conn);
+    ASSERT_NE(insert, nullptr);
+    EXPECT_EQ(insert->Execute(), E_OK);
+
+    auto [rawErr, raw] = conn->CreateStatement("UPDATE test SET id = 2 RETURNING raw", conn);
+    ASSERT_NE(raw, nullptr);
+    auto [rowsErr, rows] = raw->ExecuteForReturning(std::vector<ValueObject>(), 10);
+    EXPECT_EQ(rowsErr, E_OK);
+    ASSERT_EQ(rows.values.size(), 1);
+    EXPECT_EQ(rows.values[0].GetType(), ValueObject::TYPE_BLOB);
+    EXPECT_TRUE(std::vector<uint8_t>(rows.values[0]).empty());
+
+    auto [assetErr, asset] = conn->CreateStatement("UPDATE test SET id = 3 RETURNING data", conn);
+    ASSERT_NE(asset, nullptr);
+    auto [assetsErr, assets] = asset->ExecuteForReturning(std::vector<ValueObject>(), 10);
+    EXPECT_EQ(assetsErr, E_ERROR);
+    EXPECT_TRUE(assets.values.empty());
+    EXPECT_EQ(asset->Changes(), 1);
+
+    // GetColumn keeps the zero length blob as NULL and the corrupt asset as the default asset.
+    auto [queryErr, query] = conn->CreateStatement("SELECT data, raw FROM test", conn);
+    ASSERT_NE(query, nullptr);
+    EXPECT_EQ(query->Step(), E_OK);
+    auto [dataErr, data] = query->GetColumn(0);
+    EXPECT_EQ(dataErr, E_OK);
+    EXPECT_EQ(data.GetType(), ValueObject::TYPE_ASSET);
+    auto [blobErr, blob] = query->GetColumn(1);
+    EXPECT_EQ(blobErr, E_OK);
+    EXPECT_EQ(blob.GetType(), ValueObject::TYPE_NULL);
+
+    create = nullptr;
+    insert = nullptr;
+    raw = nullptr;
+    asset = nullptr;
+    query = nullptr;
+    conn = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
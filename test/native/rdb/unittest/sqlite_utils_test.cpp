@@ -24,6 +24,9 @@
 #include <fstream>
 #include <string>
 #include <iostream>
+#include <random>
+#include <regex>
+#include <sstream>
 #include <sys/stat.h>
 #include <unistd.h>
 #include "acl.h"
@@ -203,6 +206,78 @@ HWTEST_F(SqliteUtilsTest, SqlAnonymous_004, TestSize.Level0)
         "INSERT INTO tes*** (m**, add***) VALUES ('48:***:***:***:***:***', '***B4EE-***-***-***-***71E7')");
 }
 
+// the regex implementation which SqlAnonymous replaced, the outputs must stay the same.
+static std::string RegexSqlAnonymous(const std::string &sql)
+{
+    auto byteAnonymous = [](const std::string &input) {
+        std::string output;
+        bool maskCurrent = false;
+        for (unsigned char byte : input) {
+            if (byte > 0x7F) {
+                output += maskCurrent ? "" : "***";
+                maskCurrent = true;
+            } else {
+                output.push_back(static_cast<char>(byte));
+                maskCurrent = false;
+            }
+        }
+        return output;
+    };
+    std::ostringstream result;
+    std::regex idRegex(R"(\b[a-zA-Z0-9_]+\b)");
+    bool fullyAnonymizeFollowingDigits = false;
+    size_t lastPos = 0;
+    for (auto it = std::sregex_iterator(sql.begin(), sql.end(), idRegex); it != std::sregex_iterator(); ++it) {
+        std::string word = it->str();
+        size_t pos = static_cast<size_t>(it->position());
+        result << byteAnonymous(sql.substr(lastPos, pos - lastPos));
+        lastPos = pos + word.length();
+        if (SqliteUtils::IsKeyword(word)) {
+            result << word;
+            fullyAnonymizeFollowingDigits = false;
+        } else if (std::regex_match(word, std::regex(R"(\b[0-9a-fA-F]+\b)"))) {
+            result << SqliteUtils::AnonymousDigits(word, fullyAnonymizeFollowingDigits);
+            fullyAnonymizeFollowingDigits = true;
+        } else {
+            result << SqliteUtils::GetAnonymousName(word);
+            fullyAnonymizeFollowingDigits = false;
+        }
+    }
+    result << byteAnonymous(sql.substr(lastPos));
+    return result.str();
+}
+
+/**
+ * @tc.name: SqlAnonymous_005
+ * @tc.desc: the tokenizer gives the same output as the regex implementation
+ * @tc.type: FUNC
+ */
+HWTEST_F(SqliteUtilsTest, SqlAnonymous_005, TestSize.Level1)
+{
+    std::vector<std::string> sqls = { "", "_", "a", "1", "abc_", "SELECT * FROM users WHERE id = 1",
+        "30005245854585524412855412 123edf4 30005 300052", "hello简体cplus中文world", "简体中文", "a\x80\x80b",
+        "UPDATE t SET x=0x1F, y='EEC2B4EE-D8EB' WHERE z IN (1234567, 0012345678)", "abc123 123abc __init__ 00_11",
+        "recovered 9 frames from WAL file /data/storage/el1/database/entry/hello.db-wal" };
+    const char alphabet[] = "aZfF09_ .,:'\"[]()-\x80\xe4\xb8";
+    std::mt19937 random(0);
+    for (int i = 0; i < 2000; i++) {
+        std::string sql;
+        for (size_t len = random() % 40; len > 0; len--) {
+            sql.push_back(alphabet[random() % (sizeof(alphabet) - 1)]);
+        }
+        sqls.push_back(std::move(sql));
+    }
+    for (auto &sql : sqls) {
+        auto expect = RegexSqlAnonymous(sql);
+        EXPECT_EQ(SqliteUtils::DoSqlAnonymous(sql), expect) << sql;
+        EXPECT_EQ(SqliteUtils::SqlAnonymous(sql), expect) << sql;
+        // the second call is answered by the cache.
+        EXPECT_EQ(SqliteUtils::SqlAnonymous(sql), expect) << sql;
+    }
+    std::string longSql(SqliteUtils::SQL_ANONYMOUS_MAX_LENGTH + 1, 'x');
+    EXPECT_EQ(SqliteUtils::SqlAnonymous(longSql), RegexSqlAnonymous(longSql));
+}
+
 HWTEST_F(SqliteUtilsTest, SqliteUtils_Test_0024, TestSize.Level1)
 {
     EXPECT_EQ(0, SqliteUtils::DeleteFolder("non_exist_folder/random123"));
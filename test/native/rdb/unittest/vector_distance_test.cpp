@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vector_distance.h"
+
+#include <gtest/gtest.h>
+
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace testing::ext;
+using namespace OHOS::NativeRdb;
+
+namespace Test {
+class VectorDistanceTest : public testing::Test {
+public:
+    static void SetUpTestCase(void){};
+    static void TearDownTestCase(void){};
+    void SetUp(){};
+    void TearDown(){};
+
+protected:
+    // the sizes cover the empty vector, the unrolled loop, the single vector loop and the scalar tail.
+    static constexpr size_t SIZES[] = { 0, 1, 3, 4, 7, 8, 15, 16, 31, 32, 33, 100, 256, 1027 };
+    // one more float than needed, so the vectors can start at an unaligned address.
+    static std::vector<float> MakeVector(size_t size, uint32_t seed);
+    static double Tolerance(size_t size, double absSum);
+};
+
+std::vector<float> VectorDistanceTest::MakeVector(size_t size, uint32_t seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+    std::vector<float> vector(size + 1);
+    for (auto &item : vector) {
+        item = value(engine);
+    }
+    return vector;
+}
+
+// The float sum of n terms in any order is within about n * FLT_EPSILON of the sum of their absolute values.
+double VectorDistanceTest::Tolerance(size_t size, double absSum)
+{
+    return (size + 2) * FLT_EPSILON * absSum;
+}
+
+/**
+ * @tc.name: VectorDistance_L2Square_001
+ * @tc.desc: test the squared L2 distance is within the float tolerance of the double reference
+ * @tc.type: FUNC
+ */
+HWTEST_F(VectorDistanceTest, VectorDistance_L2Square_001, TestSize.Level1)
+{
+    for (size_t size : SIZES) {
+        auto lhs = MakeVector(size, size);
+        auto rhs = MakeVector(size, size + 1);
+        for (size_t offset : { 0, 1 }) {
+            double expected = 0;
+            for (size_t i = 0; i < size; ++i) {
+                double diff = static_cast<double>(lhs[i + offset]) - rhs[i + offset];
+                expected += diff * diff;
+            }
+            float result = VectorDistance::L2Square(lhs.data() + offset, rhs.data() + offset, size);
+            EXPECT_NEAR(result, expected, Tolerance(size, expected)) << "size " << size << " offset " << offset;
+        }
+        EXPECT_EQ(VectorDistance::L2Square(lhs.data(), lhs.data(), size), 0.0f);
+    }
+}
+
+/**
+ * @tc.name: VectorDistance_Dot_001
+ * @tc.desc: test the dot product is within the float tolerance of the double reference
+ * @tc.type: FUNC
+ */
+HWTEST_F(VectorDistanceTest, VectorDistance_Dot_001, TestSize.Level1)
+{
+    for (size_t size : SIZES) {
+        auto lhs = MakeVector(size, size);
+        auto rhs = MakeVector(size, size + 1);
+        for (size_t offset : { 0, 1 }) {
+            double expected = 0;
+            double absSum = 0;
+            for (size_t i = 0; i < size; ++i) {
+                double product = static_cast<double>(lhs[i + offset]) * rhs[i + offset];
+                expected += product;
+                absSum += std::fabs(product);
+            }
+            float result = VectorDistance::Dot(lhs.data() + offset, rhs.data() + offset, size);
+            EXPECT_NEAR(result, expected, Tolerance(size, absSum)) << "size " << size << " offset " << offset;
+        }
+    }
+}
+
+/**
+ * @tc.name: VectorDistance_Cosine_001
+ * @tc.desc: test the dot and the squared norms of the cosine are within the float tolerance of the double reference
+ * @tc.type: FUNC
+ */
+HWTEST_F(VectorDistanceTest, VectorDistance_Cosine_001, TestSize.Level1)
+{
+    for (size_t size : SIZES) {
+        auto lhs = MakeVector(size, size);
+        auto rhs = MakeVector(size, size + 1);
+        for (size_t offset : { 0, 1 }) {
+            double expected[3] = { 0, 0, 0 };
+            double dotAbsSum = 0;
+            for (size_t i = 0; i < size; ++i) {
+                double left = lhs[i + offset];
+                double right = rhs[i + offset];
+                expected[0] += left * right;
+                expected[1] += left * left;
+                expected[2] += right * right;
+                dotAbsSum += std::fabs(left * right);
+            }
+            // the sums are set even if they are dirty before.
+            float sums[3] = { 1.0f, 1.0f, 1.0f };
+            VectorDistance::Cosine(lhs.data() + offset, rhs.data() + offset, size, sums);
+            EXPECT_NEAR(sums[0], expected[0], Tolerance(size, dotAbsSum)) << "size " << size;
+            EXPECT_NEAR(sums[1], expected[1], Tolerance(size, expected[1])) << "size " << size;
+            EXPECT_NEAR(sums[2], expected[2], Tolerance(size, expected[2])) << "size " << size;
+        }
+    }
+}
+} // namespace Test
@@ -16,6 +16,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <map>
 #include <string>
 
 #include "datashare_predicates.h"
@@ -840,3 +841,86 @@ HWTEST_F(RdbDataShareAdapterTest, RdbUtils_Operation_Test, TestSize.Level1)
     Between(predicates);
     NotBetween(predicates);
 }
+
+class RecordWriter : public ResultSetBridge::Writer {
+public:
+    explicit RecordWriter(size_t maxRows = SIZE_MAX) : maxRows_(maxRows)
+    {
+    }
+    int AllocRow() override
+    {
+        if (rows.size() >= maxRows_) {
+            return -1;
+        }
+        rows.emplace_back();
+        return 0;
+    }
+    int Write(uint32_t column) override
+    {
+        return Put(column, ValueObject());
+    }
+    int Write(uint32_t column, int64_t value) override
+    {
+        return Put(column, ValueObject(value));
+    }
+    int Write(uint32_t column, double value) override
+    {
+        return Put(column, ValueObject(value));
+    }
+    int Write(uint32_t column, const uint8_t *value, size_t size) override
+    {
+        return Put(column, ValueObject(std::vector<uint8_t>(value, value + size)));
+    }
+    int Write(uint32_t column, const char *value, size_t sizeIncludingNull) override
+    {
+        return Put(column, ValueObject(std::string(value, sizeIncludingNull - 1)));
+    }
+    int FreeLastRow() override
+    {
+        rows.pop_back();
+        return 0;
+    }
+    std::vector<std::map<uint32_t, ValueObject>> rows;
+
+private:
+    int Put(uint32_t column, ValueObject &&value)
+    {
+        rows.back()[column] = std::move(value);
+        return 0;
+    }
+    size_t maxRows_;
+};
+
+/**
+ * @tc.name: Rdb_DataShare_Adapter_011
+ * @tc.desc: the rows copied from the shared block are the same as the rows written cell by cell
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbDataShareAdapterTest, Rdb_DataShare_Adapter_011, TestSize.Level1)
+{
+    GenerateDefaultTable();
+    auto shared = RdbUtils::ToResultSetBridge(store->QuerySql("SELECT * FROM test"));
+    auto step = RdbUtils::ToResultSetBridge(store->QueryByStep("SELECT * FROM test"));
+    ASSERT_NE(shared, nullptr);
+    ASSERT_NE(step, nullptr);
+
+    RecordWriter sharedWriter;
+    RecordWriter stepWriter;
+    EXPECT_EQ(shared->OnGo(0, 3, sharedWriter), 3);
+    EXPECT_EQ(step->OnGo(0, 3, stepWriter), 3);
+    ASSERT_EQ(sharedWriter.rows.size(), 4);
+    ASSERT_EQ(stepWriter.rows.size(), 4);
+    for (size_t i = 0; i < sharedWriter.rows.size(); i++) {
+        EXPECT_EQ(sharedWriter.rows[i].size(), stepWriter.rows[i].size());
+        for (auto &[column, value] : stepWriter.rows[i]) {
+            EXPECT_TRUE(sharedWriter.rows[i][column] == value);
+        }
+    }
+    EXPECT_TRUE(sharedWriter.rows[0][1] == ValueObject(std::string("hello")));
+    EXPECT_TRUE(sharedWriter.rows[2][4] == ValueObject(std::vector<uint8_t>{ 4, 5, 6 }));
+
+    RecordWriter fullWriter(2);
+    EXPECT_EQ(shared->OnGo(1, 3, fullWriter), 2);
+    ASSERT_EQ(fullWriter.rows.size(), 2);
+    EXPECT_TRUE(fullWriter.rows[0][1] == ValueObject(std::string("2")));
+}
@@ -17,8 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "iremote_object.h"
+#include "itypes_util.h"
 #include "message_parcel.h"
+#include "rdb_errno.h"
+#include "remote_result_set.h"
 #include "value_object.h"
 
 using namespace testing;
@@ -53,6 +58,57 @@ public:
     int Dump(int fd, const std::vector<std::u16string> &args) override { return 0; }
 };
 
+class PrefetchRemoteObject : public MockRemoteObject {
+public:
+    static constexpr int32_t ROW_COUNT = 300;
+    static constexpr int32_t COLUMN_COUNT = 2;
+
+    // the broken stub replies the columns and the extra rows it does not have.
+    explicit PrefetchRemoteObject(bool isSupported, int32_t columns = COLUMN_COUNT, int32_t extraRows = 0)
+        : isSupported_(isSupported), columns_(columns), extraRows_(extraRows)
+    {
+    }
+
+    int SendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        codes_.push_back(code);
+        if (code == RemoteResultSet::CMD_GET_ALL_COLUMN_NAMES) {
+            ITypesUtil::Marshal(reply, E_OK, std::vector<std::string>{ "id", "name" });
+            return 0;
+        }
+        if (code != RemoteResultSet::CMD_GET_ROWS) {
+            ITypesUtil::Marshal(reply, E_OK);
+            return 0;
+        }
+        if (!isSupported_) {
+            ITypesUtil::Marshal(reply, E_ERROR);
+            return 0;
+        }
+        data.ReadInterfaceToken();
+        int32_t position = 0;
+        int32_t maxCount = 0;
+        ITypesUtil::Unmarshal(data, position, maxCount);
+        int32_t rows = std::max(0, std::min(maxCount, ROW_COUNT - position));
+        ITypesUtil::Marshal(reply, E_OK, rows + extraRows_, columns_, position + rows >= ROW_COUNT);
+        for (int32_t row = position; row < position + rows; ++row) {
+            ITypesUtil::Marshal(reply, ValueObject(static_cast<int64_t>(row)).value,
+                ValueObject("name_" + std::to_string(row)).value);
+        }
+        return 0;
+    }
+
+    size_t Count(uint32_t code) const
+    {
+        return std::count(codes_.begin(), codes_.end(), code);
+    }
+
+private:
+    bool isSupported_;
+    int32_t columns_;
+    int32_t extraRows_;
+    std::vector<uint32_t> codes_;
+};
+
 class ResultSetProxyTest : public testing::Test {
 public:
     static void SetUpTestCase(void){};
@@ -210,4 +266,80 @@ HWTEST_F(ResultSetProxyTest, Close_001, TestSize.Level1)
     
     EXPECT_TRUE(result >= 0);
 }
+
+/**
+ * @tc.name: Prefetch_001
+ * @tc.desc: Test the rows are scanned from the prefetched window without the ipc of each cell
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResultSetProxyTest, Prefetch_001, TestSize.Level1)
+{
+    sptr<PrefetchRemoteObject> remote = new PrefetchRemoteObject(true);
+    ResultSetProxy proxy(remote, RemoteResultSet::CAP_GET_ROWS);
+
+    int32_t count = 0;
+    while (proxy.GoToNextRow() == E_OK) {
+        int64_t id = -1;
+        EXPECT_EQ(proxy.GetLong(0, id), E_OK);
+        EXPECT_EQ(id, count);
+        std::string name;
+        EXPECT_EQ(proxy.GetString(1, name), E_OK);
+        EXPECT_EQ(name, "name_" + std::to_string(count));
+        ColumnType type = ColumnType::TYPE_NULL;
+        EXPECT_EQ(proxy.GetColumnType(1, type), E_OK);
+        EXPECT_EQ(type, ColumnType::TYPE_STRING);
+        count++;
+    }
+    EXPECT_EQ(count, PrefetchRemoteObject::ROW_COUNT);
+    bool isEnded = false;
+    EXPECT_EQ(proxy.IsEnded(isEnded), E_OK);
+    EXPECT_TRUE(isEnded);
+    EXPECT_EQ(proxy.GoToPreviousRow(), E_OK);
+    int64_t id = -1;
+    EXPECT_EQ(proxy.GetLong(0, id), E_OK);
+    EXPECT_EQ(id, PrefetchRemoteObject::ROW_COUNT - 1);
+
+    // 128 rows each window, the last one is short and ends the result set.
+    EXPECT_EQ(remote->Count(RemoteResultSet::CMD_GET_ROWS), 3);
+    EXPECT_EQ(remote->Count(RemoteResultSet::CMD_GET), 0);
+    EXPECT_EQ(remote->Count(RemoteResultSet::CMD_GO_TO_NEXT_ROW), 0);
+}
+
+/**
+ * @tc.name: Prefetch_002
+ * @tc.desc: Test the proxy sends the ipc of each call without CMD_GET_ROWS if the stub does not report CAP_GET_ROWS
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResultSetProxyTest, Prefetch_002, TestSize.Level1)
+{
+    sptr<PrefetchRemoteObject> remote = new PrefetchRemoteObject(false);
+    ResultSetProxy proxy(remote);
+
+    EXPECT_EQ(proxy.GoToNextRow(), E_OK);
+    EXPECT_EQ(proxy.GoToNextRow(), E_OK);
+    int64_t id = -1;
+    proxy.GetLong(0, id);
+    EXPECT_EQ(remote->Count(RemoteResultSet::CMD_GET_ROWS), 0);
+    EXPECT_EQ(remote->Count(RemoteResultSet::CMD_GO_TO_NEXT_ROW), 2);
+    EXPECT_EQ(remote->Count(RemoteResultSet::CMD_GET), 1);
+}
+
+/**
+ * @tc.name: Prefetch_003
+ * @tc.desc: Test the window is rejected if the stub replies more rows than requested or other columns
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResultSetProxyTest, Prefetch_003, TestSize.Level1)
+{
+    sptr<PrefetchRemoteObject> remote = new PrefetchRemoteObject(true, PrefetchRemoteObject::COLUMN_COUNT + 1);
+    ResultSetProxy proxy(remote, RemoteResultSet::CAP_GET_ROWS);
+    EXPECT_EQ(proxy.GoToNextRow(), E_ERROR);
+    int64_t id = -1;
+    EXPECT_NE(proxy.GetLong(0, id), E_OK);
+
+    remote = new PrefetchRemoteObject(true, PrefetchRemoteObject::COLUMN_COUNT, 1);
+    ResultSetProxy overflow(remote, RemoteResultSet::CAP_GET_ROWS);
+    EXPECT_EQ(overflow.GoToNextRow(), E_ERROR);
+    EXPECT_EQ(remote->Count(RemoteResultSet::CMD_GET_ROWS), 1);
+}
 } // namespace Test
\ No newline at end of file